@@ -0,0 +1,137 @@
+#include "counters.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+// Replaces the global allocation functions so every benchmark reports how many allocations it performs. The
+// counters are relaxed atomics: benchmarks read them only from the thread that runs the body, after joining any
+// workers.
+
+namespace {
+
+std::atomic<std::uint64_t> allocations{0};
+std::atomic<std::uint64_t> allocated_bytes{0};
+
+void* counted_allocate(std::size_t bytes, std::size_t alignment) noexcept
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+
+    if (bytes == 0)
+    {
+        bytes = 1;
+    }
+#if defined(_WIN32)
+    return _aligned_malloc(bytes, std::max<std::size_t>(alignment, __STDCPP_DEFAULT_NEW_ALIGNMENT__));
+#else
+    if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        return std::malloc(bytes);
+    }
+    return std::aligned_alloc(alignment, (bytes + alignment - 1) / alignment * alignment);
+#endif
+}
+
+void counted_free(void* ptr) noexcept
+{
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void* counted_allocate_or_throw(std::size_t bytes, std::size_t alignment)
+{
+    void* ptr = counted_allocate(bytes, alignment);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+}  // namespace
+
+namespace vector::bench {
+
+AllocationStats allocation_stats() noexcept
+{
+    return {allocations.load(std::memory_order_relaxed), allocated_bytes.load(std::memory_order_relaxed)};
+}
+
+}  // namespace vector::bench
+
+void* operator new(std::size_t bytes)
+{
+    return counted_allocate_or_throw(bytes, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t bytes)
+{
+    return counted_allocate_or_throw(bytes, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t bytes, std::align_val_t alignment)
+{
+    return counted_allocate_or_throw(bytes, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t bytes, std::align_val_t alignment)
+{
+    return counted_allocate_or_throw(bytes, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t bytes, const std::nothrow_t& /*tag*/) noexcept
+{
+    return counted_allocate(bytes, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t bytes, const std::nothrow_t& /*tag*/) noexcept
+{
+    return counted_allocate(bytes, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*bytes*/) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*bytes*/) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*alignment*/) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t /*alignment*/) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*bytes*/, std::align_val_t /*alignment*/) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*bytes*/, std::align_val_t /*alignment*/) noexcept
+{
+    counted_free(ptr);
+}
@@ -0,0 +1,100 @@
+#include "benchmark.hpp"
+#include <vector/batch_channel.hpp>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace {
+
+// Moves 1M records from a producer to a consumer in batches of 1 to 4096, through a channel of 8 batches. The
+// threads variant pays a lock and possibly a wake-up per batch; the coroutine variant runs both ends as tasks on
+// one executor, where a full or empty channel costs a suspension instead.
+
+constexpr std::size_t records = 1'000'000;
+constexpr std::size_t channel_batches = 8;
+
+void produce_blocking(vector::BatchChannel<std::uint64_t>& channel, std::size_t batch_size)
+{
+    vector::Vector<std::uint64_t> batch;
+    for (std::size_t i = 0; i < records; i++)
+    {
+        batch.push_back(i);
+        if (batch.size() == batch_size)
+        {
+            channel.send(batch);
+        }
+    }
+    if (!batch.empty())
+    {
+        channel.send(batch);
+    }
+    channel.close();
+}
+
+vector::Task produce(vector::BatchChannel<std::uint64_t>& channel, std::size_t batch_size)
+{
+    vector::Vector<std::uint64_t> batch;
+    for (std::size_t i = 0; i < records; i++)
+    {
+        batch.push_back(i);
+        if (batch.size() == batch_size)
+        {
+            co_await channel.async_send(batch);
+        }
+    }
+    if (!batch.empty())
+    {
+        co_await channel.async_send(batch);
+    }
+    channel.close();
+}
+
+vector::Task consume(vector::BatchChannel<std::uint64_t>& channel, std::uint64_t& sum)
+{
+    while (std::optional<vector::Vector<std::uint64_t>> batch = co_await channel.async_receive())
+    {
+        for (const std::uint64_t value : std::as_const(*batch))
+        {
+            sum += value;
+        }
+        channel.recycle(std::move(*batch));
+    }
+}
+
+bool add_for(std::size_t batch_size)
+{
+    const std::string suffix = "/batch" + std::to_string(batch_size);
+
+    vector::bench::add("batch_channel/threads" + suffix, records, [batch_size] {
+        vector::BatchChannel<std::uint64_t> channel(channel_batches);
+        std::thread producer(produce_blocking, std::ref(channel), batch_size);
+
+        std::uint64_t sum = 0;
+        while (std::optional<vector::Vector<std::uint64_t>> batch = channel.receive())
+        {
+            for (const std::uint64_t value : std::as_const(*batch))
+            {
+                sum += value;
+            }
+            channel.recycle(std::move(*batch));
+        }
+        producer.join();
+        vector::bench::do_not_optimize(sum);
+    });
+
+    return vector::bench::add("batch_channel/coroutines" + suffix, records, [batch_size] {
+        vector::BatchChannel<std::uint64_t> channel(channel_batches);
+        std::uint64_t sum = 0;
+
+        vector::Executor executor;
+        executor.spawn(consume(channel, sum));
+        executor.spawn(produce(channel, batch_size));
+        executor.run();
+        vector::bench::do_not_optimize(sum);
+    });
+}
+
+const bool registered = add_for(1) && add_for(64) && add_for(4096);
+
+}  // namespace
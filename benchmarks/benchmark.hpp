@@ -0,0 +1,224 @@
+#pragma once
+#include "counters.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vector::bench {
+
+struct Benchmark
+{
+    std::string name;
+    std::size_t items;
+    std::function<void()> body;
+};
+
+inline std::vector<Benchmark>& registry()
+{
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+// Registers a benchmark whose body processes `items` elements per call; used from namespace-scope initializers.
+inline bool add(std::string name, std::size_t items, std::function<void()> body)
+{
+    registry().push_back({std::move(name), items, std::move(body)});
+    return true;
+}
+
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static_cast<void>(value);
+#endif
+}
+
+// Log-linear histogram of per-operation latencies: exact below 16 ns, then eight buckets per power of two, so
+// percentiles are within 12.5% of the true value without storing samples or allocating while timing.
+class LatencyHistogram
+{
+    static constexpr std::size_t linear = 16;
+    static constexpr std::size_t sub_buckets = 8;
+
+    std::array<std::uint64_t, linear + (64 - 4) * sub_buckets> buckets{};
+    std::uint64_t samples = 0;
+    std::uint64_t slowest = 0;
+
+    static std::size_t bucket(std::uint64_t ns) noexcept
+    {
+        if (ns < linear)
+        {
+            return ns;
+        }
+        const auto exponent = static_cast<std::size_t>(std::bit_width(ns)) - 1;
+        return linear + (exponent - 4) * sub_buckets + ((ns >> (exponent - 3)) & (sub_buckets - 1));
+    }
+
+    static std::uint64_t upper_bound(std::size_t index) noexcept
+    {
+        if (index < linear)
+        {
+            return index;
+        }
+        const std::size_t exponent = (index - linear) / sub_buckets + 4;
+        const std::size_t sub = (index - linear) % sub_buckets;
+        return ((sub_buckets + sub + 1) << (exponent - 3)) - 1;
+    }
+
+   public:
+    void record(std::uint64_t ns) noexcept
+    {
+        ++buckets[bucket(ns)];
+        ++samples;
+        slowest = std::max(slowest, ns);
+    }
+
+    void reset() noexcept
+    {
+        buckets.fill(0);
+        samples = 0;
+        slowest = 0;
+    }
+
+    [[nodiscard]] std::uint64_t count() const noexcept
+    {
+        return samples;
+    }
+
+    [[nodiscard]] std::uint64_t max() const noexcept
+    {
+        return slowest;
+    }
+
+    // Upper bound of the bucket holding the sample of the given rank, e.g. 0.99 for p99.
+    [[nodiscard]] std::uint64_t percentile(double fraction) const noexcept
+    {
+        const auto rank = std::max<std::uint64_t>(
+            static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(samples))), 1);
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < buckets.size(); i++)
+        {
+            seen += buckets[i];
+            if (seen >= rank)
+            {
+                return std::min(upper_bound(i), slowest);
+            }
+        }
+        return slowest;
+    }
+};
+
+inline LatencyHistogram& latency_histogram()
+{
+    static LatencyHistogram histogram;
+    return histogram;
+}
+
+// Runs one operation of a benchmark body and records its wall time; benchmarks that time their operations
+// this way also report latency percentiles. The clock reads are included in ns/item.
+template <typename F>
+inline void timed(F&& operation)
+{
+    const auto start = std::chrono::steady_clock::now();
+    std::forward<F>(operation)();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    latency_histogram().record(
+        static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+}
+
+struct Latency
+{
+    double p50_ns = 0;
+    double p99_ns = 0;
+    double max_ns = 0;
+};
+
+struct Result
+{
+    std::size_t iterations = 0;
+    double ns_per_iteration = 0;
+    double ns_per_item = 0;
+    double allocations_per_iteration = 0;
+    double bytes_per_iteration = 0;
+    CounterValues counters_per_iteration{};
+    std::optional<Latency> latency;
+};
+
+// Doubles the iteration count until a batch takes at least min_time, and reports that batch's wall time,
+// allocations and hardware counters per iteration, and the latencies of the operations it timed.
+inline Result run(
+    const Benchmark& benchmark,
+    PerfCounters& counters,
+    std::chrono::nanoseconds min_time = std::chrono::milliseconds(200))
+{
+    using clock = std::chrono::steady_clock;
+
+    benchmark.body();
+
+    std::size_t iterations = 1;
+    while (true)
+    {
+        latency_histogram().reset();
+        const AllocationStats allocations_before = allocation_stats();
+        counters.start();
+        const auto start = clock::now();
+        for (std::size_t i = 0; i < iterations; i++)
+        {
+            benchmark.body();
+        }
+        const auto elapsed = clock::now() - start;
+        const CounterValues counted = counters.stop();
+        const AllocationStats allocations_after = allocation_stats();
+
+        if ((elapsed >= min_time) || (iterations >= (std::size_t{1} << 30)))
+        {
+            const auto per_iteration = [iterations](double total) { return total / static_cast<double>(iterations); };
+            const auto ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+            Result result;
+            result.iterations = iterations;
+            result.ns_per_iteration = per_iteration(ns);
+            result.ns_per_item
+                = result.ns_per_iteration / static_cast<double>(std::max<std::size_t>(benchmark.items, 1));
+            result.allocations_per_iteration
+                = per_iteration(static_cast<double>(allocations_after.allocations - allocations_before.allocations));
+            result.bytes_per_iteration
+                = per_iteration(static_cast<double>(allocations_after.bytes - allocations_before.bytes));
+
+            for (std::size_t i = 0; i < counter_count; i++)
+            {
+                if (counted[i])
+                {
+                    result.counters_per_iteration[i] = per_iteration(*counted[i]);
+                }
+            }
+
+            const LatencyHistogram& latencies = latency_histogram();
+            if (latencies.count() > 0)
+            {
+                result.latency = Latency{
+                    static_cast<double>(latencies.percentile(0.50)),
+                    static_cast<double>(latencies.percentile(0.99)),
+                    static_cast<double>(latencies.max()),
+                };
+            }
+            return result;
+        }
+
+        iterations *= 2;
+    }
+}
+
+}  // namespace vector::bench
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Compares two benchmark runs written with --format=csv or --format=json.
+
+Every metric is lower-is-better. A benchmark regresses when a metric grows by more than the threshold relative to
+the baseline; metrics missing from either run (for example hardware counters on a machine without a PMU) are
+skipped. Exits with status 1 if any regression is found.
+
+    benchmarks --format=json > before.json
+    benchmarks --format=json > after.json
+    benchmarks/compare.py before.json after.json --threshold 5
+"""
+
+import argparse
+import csv
+import json
+import sys
+
+METRICS = [
+    "ns_per_item",
+    "allocations_per_iteration",
+    "bytes_per_iteration",
+    "cycles",
+    "instructions",
+    "l1d_misses",
+    "llc_misses",
+    "branch_misses",
+    "p50_ns",
+    "p99_ns",
+]
+
+# Per-iteration values this small are treated as equal, so that e.g. 0 -> 0.001 allocations is not flagged.
+ABSOLUTE_TOLERANCE = {
+    "allocations_per_iteration": 0.5,
+    "bytes_per_iteration": 8.0,
+}
+
+
+def parse_number(value):
+    if value is None or value == "":
+        return None
+    return float(value)
+
+
+def load(path):
+    with open(path, encoding="utf-8") as file:
+        text = file.read()
+
+    if text.lstrip().startswith("{"):
+        rows = json.loads(text)["benchmarks"]
+    else:
+        rows = list(csv.DictReader(text.splitlines()))
+
+    return {row["name"]: {metric: parse_number(row.get(metric)) for metric in METRICS} for row in rows}
+
+
+def compare(baseline, candidate, metrics, threshold):
+    regressions = []
+    lines = []
+
+    for name in sorted(baseline.keys() & candidate.keys()):
+        for metric in metrics:
+            before = baseline[name][metric]
+            after = candidate[name][metric]
+            if before is None or after is None:
+                continue
+
+            if abs(after - before) <= ABSOLUTE_TOLERANCE.get(metric, 0.0):
+                change = 0.0
+            elif before == 0:
+                change = float("inf")
+            else:
+                change = (after - before) / before * 100.0
+
+            regressed = change > threshold
+            if regressed:
+                regressions.append((name, metric))
+            if regressed or change < -threshold:
+                marker = "REGRESSION" if regressed else "improvement"
+                lines.append(f"{marker:<12} {name:<56} {metric:<26} {before:>14.3f} -> {after:>14.3f} ({change:+.1f}%)")
+
+    for name in sorted(baseline.keys() - candidate.keys()):
+        lines.append(f"{'missing':<12} {name}")
+
+    return regressions, lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline")
+    parser.add_argument("candidate")
+    parser.add_argument("--threshold", type=float, default=5.0, help="allowed growth in percent (default: 5)")
+    parser.add_argument(
+        "--metrics",
+        default=",".join(METRICS),
+        help="comma-separated metrics to check (default: all)",
+    )
+    args = parser.parse_args()
+
+    metrics = [metric for metric in args.metrics.split(",") if metric]
+    unknown = [metric for metric in metrics if metric not in METRICS]
+    if unknown:
+        parser.error(f"unknown metrics: {', '.join(unknown)}")
+
+    regressions, lines = compare(load(args.baseline), load(args.candidate), metrics, args.threshold)
+
+    for line in lines:
+        print(line)
+    print(f"{len(regressions)} regression(s) over {args.threshold:g}%")
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
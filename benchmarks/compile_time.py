@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+"""Measures what the precompiled instantiations of vector::instantiations save when compiling a user of Vector.
+
+Compiles compile_time_probe.cpp with and without VECTOR_EXTERN_TEMPLATES at each optimization level and reports
+the median wall time and the size of the object's code. Only time spent in the probe is counted; the companion
+library is compiled once, like any other dependency.
+
+    benchmarks/compile_time.py --compiler g++ --repeat 5 --levels O0,O2
+"""
+
+import argparse
+import pathlib
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+PROBE = ROOT / "benchmarks" / "compile_time_probe.cpp"
+FLAGS = ["-std=c++20", f"-I{ROOT / 'include'}", "-c"]
+
+
+def text_size(path):
+    """Bytes of code in an object file, from binutils size, or the file size if that is not available."""
+    try:
+        output = subprocess.run(["size", str(path)], check=True, capture_output=True, text=True).stdout
+        return int(output.splitlines()[-1].split()[0])
+    except (OSError, subprocess.CalledProcessError, ValueError, IndexError):
+        return path.stat().st_size
+
+
+def measure(compiler, level, extra, repeat, output):
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        subprocess.run([compiler, level, *FLAGS, *extra, str(PROBE), "-o", str(output)], check=True)
+        times.append(time.perf_counter() - start)
+    return statistics.median(times), text_size(output)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--compiler", default="c++")
+    parser.add_argument("--repeat", type=int, default=5)
+    parser.add_argument("--levels", default="O0,O2", help="comma-separated optimization levels")
+    args = parser.parse_args()
+
+    print(f"{'level':<8}{'mode':<18}{'seconds':>10}{'text bytes':>14}")
+    with tempfile.TemporaryDirectory() as directory:
+        output = pathlib.Path(directory) / "probe.o"
+        for level in (f"-{name}" for name in args.levels.split(",")):
+            for mode, extra in (("header-only", []), ("extern templates", ["-DVECTOR_EXTERN_TEMPLATES"])):
+                seconds, size = measure(args.compiler, level, extra, args.repeat, output)
+                print(f"{level:<8}{mode:<18}{seconds:>10.3f}{size:>14}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
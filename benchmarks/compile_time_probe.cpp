@@ -0,0 +1,48 @@
+// Translation unit for compile_time.py: exercises most of Vector for each precompiled element type, the way a
+// typical user of the library would.
+#include <vector/vector.hpp>
+#include <cstddef>
+#include <string>
+
+namespace {
+
+template <typename T>
+std::size_t exercise(const T& value)
+{
+    vector::Vector<T> vec;
+    vec.reserve(16);
+    vec.push_back(value);
+    vec.emplace_back(value);
+    vec.insert(vec.begin(), value);
+    vec.insert(vec.begin() + 1, 3, value);
+    vec.append({value, value});
+
+    vector::Vector<T> copy = vec;
+    copy.erase(copy.begin());
+    copy.erase(copy.begin(), copy.begin() + 1);
+    copy.swap_remove(copy.begin());
+    copy.resize(20, value);
+    copy.pop_back();
+    copy.shrink_to_fit();
+    vector::erase(copy, value);
+
+    std::size_t count = 0;
+    for (const T& element : std::as_const(vec))
+    {
+        count += (element == value) ? 1 : 0;
+    }
+    vec.clear();
+    return count + copy.size() + vec.size();
+}
+
+}  // namespace
+
+std::size_t compile_time_probe()
+{
+    return exercise(1) + exercise(2.0) + exercise(std::string("value")) + exercise(std::byte{3});
+}
+
+int main()
+{
+    return compile_time_probe() == 0 ? 1 : 0;
+}
@@ -0,0 +1,88 @@
+#include "benchmark.hpp"
+#include <vector/compressed_vector.hpp>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+
+namespace {
+
+// Sorted uint64 ID lists with random gaps of up to `max_gap`. Sums measure decode throughput against reading the
+// plain Vector; bytes/iter of the compress benchmarks is the compressed footprint, against 8 bytes per value
+// uncompressed.
+
+constexpr std::size_t elements = 1'000'000;
+
+const vector::Vector<std::uint64_t>& ids(std::uint64_t max_gap)
+{
+    static std::map<std::uint64_t, vector::Vector<std::uint64_t>> cache;
+    auto it = cache.find(max_gap);
+    if (it == cache.end())
+    {
+        std::mt19937_64 rng(max_gap);
+        vector::Vector<std::uint64_t> values(elements);
+        std::uint64_t id = 1'000'000'000;
+        for (std::size_t i = 0; i < elements; i++)
+        {
+            id += rng() % (max_gap + 1);
+            values.push_back(id);
+        }
+        it = cache.emplace(max_gap, std::move(values)).first;
+    }
+    return it->second;
+}
+
+const vector::CompressedVector<std::uint64_t>& compressed(std::uint64_t max_gap)
+{
+    static std::map<std::uint64_t, vector::CompressedVector<std::uint64_t>> cache;
+    auto it = cache.find(max_gap);
+    if (it == cache.end())
+    {
+        it = cache.emplace(max_gap, vector::CompressedVector<std::uint64_t>(ids(max_gap))).first;
+    }
+    return it->second;
+}
+
+bool add_for(std::uint64_t max_gap)
+{
+    const std::string suffix = "/gap" + std::to_string(max_gap) + "/" + std::to_string(elements);
+
+    vector::bench::add("compressed_vector/sum/Vector" + suffix, elements, [max_gap] {
+        const auto& values = ids(max_gap);
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            sum += values[i];
+        }
+        vector::bench::do_not_optimize(sum);
+    });
+
+    vector::bench::add("compressed_vector/sum/CompressedVector" + suffix, elements, [max_gap] {
+        std::uint64_t sum = 0;
+        compressed(max_gap).for_each([&sum](std::uint64_t value) { sum += value; });
+        vector::bench::do_not_optimize(sum);
+    });
+
+    vector::bench::add("compressed_vector/to_vector" + suffix, elements, [max_gap] {
+        vector::bench::do_not_optimize(compressed(max_gap).to_vector().size());
+    });
+
+    vector::bench::add("compressed_vector/random_access" + suffix, 1000, [max_gap] {
+        const auto& values = compressed(max_gap);
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < 1000; i++)
+        {
+            sum += values[(i * 7919) % elements];
+        }
+        vector::bench::do_not_optimize(sum);
+    });
+
+    return vector::bench::add("compressed_vector/compress" + suffix, elements, [max_gap] {
+        const vector::CompressedVector<std::uint64_t> result(ids(max_gap));
+        vector::bench::do_not_optimize(result.memory_bytes());
+    });
+}
+
+const bool registered = add_for(16) && add_for(1000) && add_for(1'000'000);
+
+}  // namespace
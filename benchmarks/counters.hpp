@@ -0,0 +1,70 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace vector::bench {
+
+// Totals maintained by the replacement global operator new in allocation_counter.cpp.
+struct AllocationStats
+{
+    std::uint64_t allocations = 0;
+    std::uint64_t bytes = 0;
+};
+
+AllocationStats allocation_stats() noexcept;
+
+enum class Counter : std::size_t
+{
+    cycles,
+    instructions,
+    l1d_misses,
+    llc_misses,
+    branch_misses,
+};
+
+inline constexpr std::size_t counter_count = 5;
+
+inline constexpr std::array<std::string_view, counter_count> counter_names{
+    "cycles",
+    "instructions",
+    "l1d_misses",
+    "llc_misses",
+    "branch_misses",
+};
+
+using CounterValues = std::array<std::optional<double>, counter_count>;
+
+// Hardware counters of the calling thread and the threads it starts, opened through perf_event_open on Linux.
+// Counters the kernel or CPU refuses (no PMU in a VM, perf_event_paranoid, other platforms) read as std::nullopt.
+// Values are scaled for multiplexing.
+class PerfCounters
+{
+    struct Reading
+    {
+        std::uint64_t value = 0;
+        std::uint64_t enabled = 0;
+        std::uint64_t running = 0;
+    };
+
+    std::array<int, counter_count> fds;
+    std::array<Reading, counter_count> baseline{};
+
+   public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    [[nodiscard]] bool available() const noexcept;
+
+    void start() noexcept;
+
+    // Counts since the last start().
+    [[nodiscard]] CounterValues stop() noexcept;
+};
+
+}  // namespace vector::bench
@@ -0,0 +1,100 @@
+#include "benchmark.hpp"
+#include <vector/expression.hpp>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+using namespace vector::arithmetic;
+
+// a = b * c + d evaluated through expression templates, by a hand-written loop over std::vector, and by
+// materializing one Vector per operator; and the dot product against std::inner_product.
+
+constexpr std::size_t elements = 100'000;
+
+template <typename Vec>
+Vec make_input(double scale)
+{
+    Vec vec;
+    for (std::size_t i = 0; i < elements; i++)
+    {
+        vec.push_back(static_cast<double>(i % 1000) * scale);
+    }
+    return vec;
+}
+
+vector::Vector<double> multiply(const vector::Vector<double>& lhs, const vector::Vector<double>& rhs)
+{
+    vector::Vector<double> result(lhs.size());
+    for (std::size_t i = 0; i < lhs.size(); i++)
+    {
+        result.push_back(lhs[i] * rhs[i]);
+    }
+    return result;
+}
+
+vector::Vector<double> add(const vector::Vector<double>& lhs, const vector::Vector<double>& rhs)
+{
+    vector::Vector<double> result(lhs.size());
+    for (std::size_t i = 0; i < lhs.size(); i++)
+    {
+        result.push_back(lhs[i] + rhs[i]);
+    }
+    return result;
+}
+
+bool add_fused_multiply_add()
+{
+    vector::bench::add("expression/multiply_add/std::vector_loop", elements, [] {
+        static const auto b = make_input<std::vector<double>>(0.5);
+        static const auto c = make_input<std::vector<double>>(1.5);
+        static const auto d = make_input<std::vector<double>>(2.5);
+        static std::vector<double> a(elements);
+
+        for (std::size_t i = 0; i < elements; i++)
+        {
+            a[i] = b[i] * c[i] + d[i];
+        }
+        vector::bench::do_not_optimize(a.data());
+    });
+
+    vector::bench::add("expression/multiply_add/Vector_temporaries", elements, [] {
+        static const auto b = make_input<vector::Vector<double>>(0.5);
+        static const auto c = make_input<vector::Vector<double>>(1.5);
+        static const auto d = make_input<vector::Vector<double>>(2.5);
+        static vector::Vector<double> a;
+
+        a = add(multiply(b, c), d);
+        vector::bench::do_not_optimize(a.size());
+    });
+
+    return vector::bench::add("expression/multiply_add/Vector_expression", elements, [] {
+        static const auto b = make_input<vector::Vector<double>>(0.5);
+        static const auto c = make_input<vector::Vector<double>>(1.5);
+        static const auto d = make_input<vector::Vector<double>>(2.5);
+        static vector::Vector<double> a;
+
+        a = b * c + d;
+        vector::bench::do_not_optimize(a.size());
+    });
+}
+
+bool add_dot()
+{
+    vector::bench::add("expression/dot/std::inner_product", elements, [] {
+        static const auto b = make_input<std::vector<double>>(0.5);
+        static const auto c = make_input<std::vector<double>>(1.5);
+        vector::bench::do_not_optimize(std::inner_product(b.begin(), b.end(), c.begin(), 0.0));
+    });
+
+    return vector::bench::add("expression/dot/Vector", elements, [] {
+        static const auto b = make_input<vector::Vector<double>>(0.5);
+        static const auto c = make_input<vector::Vector<double>>(1.5);
+        vector::bench::do_not_optimize(dot(b, c));
+    });
+}
+
+const bool registered = add_fused_multiply_add() && add_dot();
+
+}  // namespace
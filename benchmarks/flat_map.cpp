@@ -0,0 +1,94 @@
+#include "benchmark.hpp"
+#include <vector/flat_map.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t lookups = 4096;
+
+struct Tables
+{
+    std::map<std::uint64_t, std::uint64_t> tree;
+    std::unordered_map<std::uint64_t, std::uint64_t> hash;
+    vector::FlatMap<std::uint64_t, std::uint64_t> flat;
+    vector::FlatMap<std::uint64_t, std::uint64_t> indexed;
+    std::vector<std::uint64_t> probes;
+
+    explicit Tables(std::size_t size)
+    {
+        std::mt19937_64 rng(size);
+        std::vector<std::uint64_t> keys;
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> sorted;
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            const std::uint64_t key = rng();
+            keys.push_back(key);
+            sorted.emplace_back(key, i);
+            tree.emplace(key, i);
+            hash.emplace(key, i);
+        }
+
+        std::sort(sorted.begin(), sorted.end());
+        flat.insert_sorted_range(sorted.begin(), sorted.end());
+
+        indexed = flat;
+        indexed.build_index();
+
+        for (std::size_t i = 0; i < lookups; i++)
+        {
+            probes.push_back(i % 2 == 0 ? keys[rng() % size] : rng());
+        }
+    }
+};
+
+const Tables& tables_for(std::size_t size)
+{
+    static std::map<std::size_t, Tables> cache;
+    return cache.try_emplace(size, size).first->second;
+}
+
+template <typename Find>
+bool add_lookup(const std::string& name, std::size_t size, Find find)
+{
+    return vector::bench::add("flat_map/find/" + name + "/" + std::to_string(size), lookups, [size, find] {
+        const Tables& tables = tables_for(size);
+        std::uint64_t sum = 0;
+        for (const std::uint64_t key : tables.probes)
+        {
+            sum += find(tables, key);
+        }
+        vector::bench::do_not_optimize(sum);
+    });
+}
+
+bool add_lookups(std::size_t size)
+{
+    add_lookup("std::map", size, [](const Tables& tables, std::uint64_t key) {
+        const auto it = tables.tree.find(key);
+        return it == tables.tree.end() ? 0 : it->second;
+    });
+    add_lookup("std::unordered_map", size, [](const Tables& tables, std::uint64_t key) {
+        const auto it = tables.hash.find(key);
+        return it == tables.hash.end() ? 0 : it->second;
+    });
+    add_lookup("FlatMap", size, [](const Tables& tables, std::uint64_t key) {
+        const std::uint64_t* value = tables.flat.find(key);
+        return value == nullptr ? 0 : *value;
+    });
+    return add_lookup("FlatMap+eytzinger", size, [](const Tables& tables, std::uint64_t key) {
+        const std::uint64_t* value = tables.indexed.find(key);
+        return value == nullptr ? 0 : *value;
+    });
+}
+
+const bool registered = add_lookups(1'000) && add_lookups(100'000) && add_lookups(1'000'000);
+
+}  // namespace
@@ -0,0 +1,95 @@
+#include "benchmark.hpp"
+#include <vector/gather.hpp>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Gathers 1M random indices from sources sized for L1/L2 (16K elements), the last-level cache (1M) and main
+// memory (64M). The plain loop is the baseline; distance 0 turns prefetching off. The hardware gathers only take
+// part in builds targeting AVX2 or AVX-512.
+
+constexpr std::size_t lookups = 1'000'000;
+
+template <typename T>
+const vector::Vector<T>& source(std::size_t size)
+{
+    static std::map<std::size_t, vector::Vector<T>> cache;
+    auto it = cache.find(size);
+    if (it == cache.end())
+    {
+        vector::Vector<T> values;
+        values.overwrite(size, [size](T* out) {
+            for (std::size_t i = 0; i < size; i++)
+            {
+                out[i] = static_cast<T>(i);
+            }
+        });
+        it = cache.emplace(size, std::move(values)).first;
+    }
+    return it->second;
+}
+
+const vector::Vector<std::uint32_t>& indices(std::size_t bound)
+{
+    static std::map<std::size_t, vector::Vector<std::uint32_t>> cache;
+    auto it = cache.find(bound);
+    if (it == cache.end())
+    {
+        std::mt19937_64 rng(bound);
+        vector::Vector<std::uint32_t> values(lookups);
+        for (std::size_t i = 0; i < lookups; i++)
+        {
+            values.push_back(static_cast<std::uint32_t>(rng() % bound));
+        }
+        it = cache.emplace(bound, std::move(values)).first;
+    }
+    return it->second;
+}
+
+template <typename T>
+bool add_for(const std::string& type, std::size_t size)
+{
+    const std::string suffix = "/" + type + "/" + std::to_string(size);
+
+    vector::bench::add("gather/loop" + suffix, lookups, [size] {
+        const auto& src = source<T>(size);
+        const auto& idx = indices(size);
+        std::vector<T> out(idx.size());
+        for (std::size_t i = 0; i < idx.size(); i++)
+        {
+            out[i] = src[idx[i]];
+        }
+        vector::bench::do_not_optimize(out.data());
+    });
+
+    const std::pair<const char*, vector::GatherOptions> variants[] = {
+        {"no_prefetch", {.prefetch_distance = 0}},
+        {"prefetch", {}},
+        {"sorted", {.sort_indices = true}},
+    };
+    for (const auto& [name, options] : variants)
+    {
+        vector::bench::add("gather/" + std::string(name) + suffix, lookups, [size, options] {
+            vector::bench::do_not_optimize(vector::gather(source<T>(size), indices(size), options).size());
+        });
+    }
+
+    return vector::bench::add("gather/for_each_indexed" + suffix, lookups, [size] {
+        T sum = 0;
+        vector::for_each_indexed(source<T>(size), indices(size), [&sum](std::size_t, T value) { sum += value; });
+        vector::bench::do_not_optimize(sum);
+    });
+}
+
+const bool registered = add_for<std::uint32_t>("uint32", std::size_t{1} << 14)
+                        && add_for<std::uint32_t>("uint32", std::size_t{1} << 20)
+                        && add_for<std::uint32_t>("uint32", std::size_t{1} << 26)
+                        && add_for<std::uint64_t>("uint64", std::size_t{1} << 14)
+                        && add_for<std::uint64_t>("uint64", std::size_t{1} << 20)
+                        && add_for<std::uint64_t>("uint64", std::size_t{1} << 26);
+
+}  // namespace
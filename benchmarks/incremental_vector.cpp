@@ -0,0 +1,64 @@
+#include "benchmark.hpp"
+#include <vector/incremental_vector.hpp>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace {
+
+// Growth latency tails: every push_back of a fresh container is timed on its own. Vector moves all elements inside
+// the push_back that reallocates; IncrementalVector moves migration_step of them per push, so its max column
+// should stay near the cost of one allocation. Indexed reads show the cost of the two-buffer lookup.
+
+template <typename Container>
+const Container& filled(std::size_t count)
+{
+    static std::map<std::size_t, Container> containers;
+    auto it = containers.find(count);
+    if (it == containers.end())
+    {
+        Container vec;
+        for (std::uint64_t i = 0; i < count; i++)
+        {
+            vec.push_back(i);
+        }
+        it = containers.emplace(count, std::move(vec)).first;
+    }
+    return it->second;
+}
+
+template <typename Container>
+bool add_for(const std::string& container, std::size_t count)
+{
+    const std::string suffix = "/" + container + "/" + std::to_string(count);
+
+    vector::bench::add("incremental_vector/push_back" + suffix, count, [count] {
+        Container vec;
+        for (std::uint64_t i = 0; i < count; i++)
+        {
+            vector::bench::timed([&vec, i] { vec.push_back(i); });
+        }
+        vector::bench::do_not_optimize(vec.size());
+    });
+
+    return vector::bench::add("incremental_vector/indexed_read" + suffix, count, [count] {
+        const Container& vec = filled<Container>(count);
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            sum += vec[i];
+        }
+        vector::bench::do_not_optimize(sum);
+    });
+}
+
+bool add_sizes(std::size_t count)
+{
+    return add_for<vector::Vector<std::uint64_t>>("Vector", count)
+           && add_for<vector::IncrementalVector<std::uint64_t>>("IncrementalVector", count);
+}
+
+const bool registered = add_sizes(1'000'000) && add_sizes(8'000'000);
+
+}  // namespace
@@ -0,0 +1,77 @@
+#include "benchmark.hpp"
+#include "report.hpp"
+#include <charconv>
+#include <cstdio>
+#include <string_view>
+
+namespace {
+
+int usage(const char* program)
+{
+    std::fprintf(stderr, "usage: %s [filter] [--format=table|csv|json] [--min-time-ms=N]\n", program);
+    return 2;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    std::string_view filter;
+    vector::bench::Format format = vector::bench::Format::table;
+    std::chrono::milliseconds min_time(200);
+
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string_view arg = argv[i];
+
+        if (arg.starts_with("--format="))
+        {
+            const auto parsed = vector::bench::parse_format(arg.substr(9));
+            if (!parsed)
+            {
+                return usage(argv[0]);
+            }
+            format = *parsed;
+        }
+        else if (arg.starts_with("--min-time-ms="))
+        {
+            const std::string_view value = arg.substr(14);
+            std::size_t ms = 0;
+            const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), ms);
+            if ((error != std::errc()) || (end != value.data() + value.size()))
+            {
+                return usage(argv[0]);
+            }
+            min_time = std::chrono::milliseconds(ms);
+        }
+        else if (arg.starts_with("--") || !filter.empty())
+        {
+            return usage(argv[0]);
+        }
+        else
+        {
+            filter = arg;
+        }
+    }
+
+    vector::bench::PerfCounters counters;
+    if (!counters.available())
+    {
+        std::fprintf(stderr, "hardware counters unavailable; reporting time and allocations only\n");
+    }
+
+    vector::bench::Reporter reporter(stdout, format);
+
+    for (const auto& benchmark : vector::bench::registry())
+    {
+        if (benchmark.name.find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        reporter.add(benchmark.name, benchmark.items, vector::bench::run(benchmark, counters, min_time));
+    }
+
+    reporter.finish();
+    return 0;
+}
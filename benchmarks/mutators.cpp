@@ -0,0 +1,85 @@
+#include "benchmark.hpp"
+#include <vector/vector.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Compares the strong-guarantee mutators against std::vector for element types whose moves cannot throw; the
+// safe paths should not cost anything for them.
+
+constexpr std::size_t elements = 10'000;
+constexpr std::size_t front_inserts = 1'000;
+
+template <typename T>
+T make_value(std::size_t i)
+{
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+        return "value-with-heap-storage-" + std::to_string(i);
+    }
+    else
+    {
+        return static_cast<T>(i);
+    }
+}
+
+template <typename Vec, typename T>
+bool add_for(const std::string& container, const std::string& type)
+{
+    const std::string suffix = "/" + container + "/" + type;
+
+    vector::bench::add("mutators/push_back" + suffix, elements, [] {
+        Vec vec;
+        for (std::size_t i = 0; i < elements; i++)
+        {
+            vec.push_back(make_value<T>(i));
+        }
+        vector::bench::do_not_optimize(vec.size());
+    });
+
+    vector::bench::add("mutators/emplace_back" + suffix, elements, [] {
+        Vec vec;
+        for (std::size_t i = 0; i < elements; i++)
+        {
+            vec.emplace_back(make_value<T>(i));
+        }
+        vector::bench::do_not_optimize(vec.size());
+    });
+
+    vector::bench::add("mutators/insert_front" + suffix, front_inserts, [] {
+        Vec vec;
+        for (std::size_t i = 0; i < front_inserts; i++)
+        {
+            vec.insert(vec.begin(), make_value<T>(i));
+        }
+        vector::bench::do_not_optimize(vec.size());
+    });
+
+    vector::bench::add("mutators/insert_range_middle" + suffix, elements, [] {
+        static const std::vector<T> values(elements / 10, make_value<T>(1));
+        Vec vec;
+        for (std::size_t i = 0; i < 10; i++)
+        {
+            vec.insert(vec.begin() + static_cast<std::ptrdiff_t>(vec.size() / 2), values.begin(), values.end());
+        }
+        vector::bench::do_not_optimize(vec.size());
+    });
+
+    return vector::bench::add("mutators/resize" + suffix, elements, [] {
+        Vec vec;
+        for (std::size_t size = 1; size <= elements; size *= 2)
+        {
+            vec.resize(size, make_value<T>(size));
+        }
+        vector::bench::do_not_optimize(vec.size());
+    });
+}
+
+const bool registered = add_for<std::vector<std::uint64_t>, std::uint64_t>("std::vector", "u64")
+                        && add_for<vector::Vector<std::uint64_t>, std::uint64_t>("Vector", "u64")
+                        && add_for<std::vector<std::string>, std::string>("std::vector", "string")
+                        && add_for<vector::Vector<std::string>, std::string>("Vector", "string");
+
+}  // namespace
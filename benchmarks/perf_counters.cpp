@@ -0,0 +1,153 @@
+#include "counters.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace vector::bench {
+
+#if defined(__linux__)
+
+namespace {
+
+struct EventConfig
+{
+    std::uint32_t type;
+    std::uint64_t config;
+};
+
+constexpr std::array<EventConfig, counter_count> events{{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE,
+     PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+}};
+
+int open_event(const EventConfig& event)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = event.type;
+    attr.config = event.config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.inherit = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+// Matches read_format: the count followed by the time enabled and the time running.
+template <typename Reading>
+bool read_event(int fd, Reading& reading) noexcept
+{
+    return read(fd, &reading, sizeof(reading)) == static_cast<ssize_t>(sizeof(reading));
+}
+
+}  // namespace
+
+// Each event is opened on its own rather than as a group so that one unsupported event does not disable the
+// others; the kernel multiplexes them if the PMU runs out of registers. Inherited counts include threads the
+// benchmark spawns once they have exited.
+PerfCounters::PerfCounters()
+{
+    for (std::size_t i = 0; i < counter_count; i++)
+    {
+        fds[i] = open_event(events[i]);
+    }
+}
+
+PerfCounters::~PerfCounters()
+{
+    for (const int fd : fds)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+}
+
+bool PerfCounters::available() const noexcept
+{
+    for (const int fd : fds)
+    {
+        if (fd >= 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PerfCounters::start() noexcept
+{
+    for (std::size_t i = 0; i < counter_count; i++)
+    {
+        if (fds[i] >= 0)
+        {
+            read_event(fds[i], baseline[i]);
+        }
+    }
+}
+
+CounterValues PerfCounters::stop() noexcept
+{
+    CounterValues values;
+
+    for (std::size_t i = 0; i < counter_count; i++)
+    {
+        Reading reading{};
+        if ((fds[i] < 0) || !read_event(fds[i], reading))
+        {
+            continue;
+        }
+
+        const std::uint64_t enabled = reading.enabled - baseline[i].enabled;
+        const std::uint64_t running = reading.running - baseline[i].running;
+        if (running == 0)
+        {
+            continue;
+        }
+
+        const auto delta = static_cast<double>(reading.value - baseline[i].value);
+        values[i] = delta * static_cast<double>(enabled) / static_cast<double>(running);
+    }
+
+    return values;
+}
+
+#else
+
+PerfCounters::PerfCounters()
+{
+    fds.fill(-1);
+}
+
+PerfCounters::~PerfCounters() = default;
+
+bool PerfCounters::available() const noexcept
+{
+    return false;
+}
+
+void PerfCounters::start() noexcept
+{
+    baseline.fill({});
+}
+
+CounterValues PerfCounters::stop() noexcept
+{
+    return {};
+}
+
+#endif
+
+}  // namespace vector::bench
@@ -0,0 +1,71 @@
+#include "benchmark.hpp"
+#include <vector/published_vector.hpp>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t reads_per_thread = 20'000;
+constexpr std::size_t table_size = 1024;
+
+vector::Vector<std::uint64_t> make_table()
+{
+    vector::Vector<std::uint64_t> table;
+    table.resize(table_size, 1);
+    return table;
+}
+
+template <typename Body>
+void run_threads(std::size_t threads, Body body)
+{
+    std::vector<std::thread> workers;
+    for (std::size_t i = 0; i < threads; i++)
+    {
+        workers.emplace_back(body, i);
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+bool add_scaling(std::size_t threads)
+{
+    std::string suffix = "/";
+    suffix += std::to_string(threads);
+    suffix += "threads";
+
+    vector::bench::add("published_vector/copy_vector" + suffix, threads * reads_per_thread, [threads] {
+        static const vector::Vector<std::uint64_t> shared = make_table();
+        run_threads(threads, [](std::size_t seed) {
+            std::uint64_t sum = 0;
+            for (std::size_t i = 0; i < reads_per_thread; i++)
+            {
+                const vector::Vector<std::uint64_t> copy = shared;
+                sum += copy[(seed + i) % table_size];
+            }
+            vector::bench::do_not_optimize(sum);
+        });
+    });
+
+    return vector::bench::add("published_vector/read_guard" + suffix, threads * reads_per_thread, [threads] {
+        static vector::PublishedVector<std::uint64_t> published(make_table());
+        run_threads(threads, [](std::size_t seed) {
+            auto reader = published.register_reader();
+            std::uint64_t sum = 0;
+            for (std::size_t i = 0; i < reads_per_thread; i++)
+            {
+                const auto guard = reader.read();
+                sum += guard[(seed + i) % table_size];
+            }
+            vector::bench::do_not_optimize(sum);
+        });
+    });
+}
+
+const bool registered = add_scaling(1) && add_scaling(2) && add_scaling(4) && add_scaling(8) && add_scaling(16)
+                        && add_scaling(32) && add_scaling(64);
+
+}  // namespace
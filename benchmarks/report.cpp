@@ -0,0 +1,239 @@
+#include "report.hpp"
+#include <array>
+
+namespace vector::bench {
+
+namespace {
+
+void write_csv_string(std::FILE* out, std::string_view text)
+{
+    std::fputc('"', out);
+    for (const char c : text)
+    {
+        if (c == '"')
+        {
+            std::fputc('"', out);
+        }
+        std::fputc(c, out);
+    }
+    std::fputc('"', out);
+}
+
+void write_json_string(std::FILE* out, std::string_view text)
+{
+    std::fputc('"', out);
+    for (const char c : text)
+    {
+        if ((c == '"') || (c == '\\'))
+        {
+            std::fputc('\\', out);
+        }
+        std::fputc(c, out);
+    }
+    std::fputc('"', out);
+}
+
+constexpr std::array<std::string_view, 3> latency_names{"p50_ns", "p99_ns", "max_ns"};
+
+void write_csv_number(std::FILE* out, const std::optional<double>& value)
+{
+    if (value)
+    {
+        std::fprintf(out, ",%.1f", *value);
+    }
+    else
+    {
+        std::fprintf(out, ",");
+    }
+}
+
+void write_json_number(std::FILE* out, std::string_view name, const std::optional<double>& value)
+{
+    std::fprintf(out, ", \"%.*s\": ", static_cast<int>(name.size()), name.data());
+    if (value)
+    {
+        std::fprintf(out, "%.1f", *value);
+    }
+    else
+    {
+        std::fprintf(out, "null");
+    }
+}
+
+void write_table_latency(std::FILE* out, const std::optional<double>& value, int width)
+{
+    if (value)
+    {
+        std::fprintf(out, " %*.0f", width, *value);
+    }
+    else
+    {
+        std::fprintf(out, " %*s", width, "-");
+    }
+}
+
+void write_table_counter(std::FILE* out, const std::optional<double>& value)
+{
+    if (value)
+    {
+        std::fprintf(out, " %14.0f", *value);
+    }
+    else
+    {
+        std::fprintf(out, " %14s", "-");
+    }
+}
+
+// The latency columns, or nothing for benchmarks that do not time their operations.
+std::array<std::optional<double>, 3> latency_values(const Result& result)
+{
+    if (!result.latency)
+    {
+        return {};
+    }
+    return {result.latency->p50_ns, result.latency->p99_ns, result.latency->max_ns};
+}
+
+}  // namespace
+
+std::optional<Format> parse_format(std::string_view name)
+{
+    if (name == "table")
+    {
+        return Format::table;
+    }
+    if (name == "csv")
+    {
+        return Format::csv;
+    }
+    if (name == "json")
+    {
+        return Format::json;
+    }
+    return std::nullopt;
+}
+
+Reporter::Reporter(std::FILE* out, Format format) : out(out), format(format)
+{
+    switch (format)
+    {
+        case Format::table:
+            std::fprintf(
+                out,
+                "%-56s %12s %12s %10s %12s %12s %14s %14s %10s %10s %12s\n",
+                "benchmark",
+                "iterations",
+                "ns/iter",
+                "ns/item",
+                "allocs/iter",
+                "bytes/iter",
+                "cycles/iter",
+                "instr/iter",
+                "p50 ns",
+                "p99 ns",
+                "max ns");
+            break;
+        case Format::csv:
+            std::fprintf(
+                out,
+                "name,items,iterations,ns_per_iteration,ns_per_item,allocations_per_iteration,bytes_per_iteration");
+            for (const std::string_view counter : counter_names)
+            {
+                std::fprintf(out, ",%.*s", static_cast<int>(counter.size()), counter.data());
+            }
+            for (const std::string_view latency : latency_names)
+            {
+                std::fprintf(out, ",%.*s", static_cast<int>(latency.size()), latency.data());
+            }
+            std::fprintf(out, "\n");
+            break;
+        case Format::json:
+            std::fprintf(out, "{\n  \"benchmarks\": [");
+            break;
+    }
+}
+
+void Reporter::add(const std::string& name, std::size_t items, const Result& result)
+{
+    const auto& counters = result.counters_per_iteration;
+    const auto latencies = latency_values(result);
+
+    switch (format)
+    {
+        case Format::table:
+            std::fprintf(
+                out,
+                "%-56s %12zu %12.1f %10.3f %12.2f %12.0f",
+                name.c_str(),
+                result.iterations,
+                result.ns_per_iteration,
+                result.ns_per_item,
+                result.allocations_per_iteration,
+                result.bytes_per_iteration);
+            write_table_counter(out, counters[static_cast<std::size_t>(Counter::cycles)]);
+            write_table_counter(out, counters[static_cast<std::size_t>(Counter::instructions)]);
+            write_table_latency(out, latencies[0], 10);
+            write_table_latency(out, latencies[1], 10);
+            write_table_latency(out, latencies[2], 12);
+            std::fprintf(out, "\n");
+            break;
+        case Format::csv:
+            write_csv_string(out, name);
+            std::fprintf(
+                out,
+                ",%zu,%zu,%.3f,%.4f,%.3f,%.1f",
+                items,
+                result.iterations,
+                result.ns_per_iteration,
+                result.ns_per_item,
+                result.allocations_per_iteration,
+                result.bytes_per_iteration);
+            for (const auto& value : counters)
+            {
+                write_csv_number(out, value);
+            }
+            for (const auto& value : latencies)
+            {
+                write_csv_number(out, value);
+            }
+            std::fprintf(out, "\n");
+            break;
+        case Format::json:
+            std::fprintf(out, "%s\n    {\"name\": ", written == 0 ? "" : ",");
+            write_json_string(out, name);
+            std::fprintf(
+                out,
+                ", \"items\": %zu, \"iterations\": %zu, \"ns_per_iteration\": %.3f, \"ns_per_item\": %.4f, "
+                "\"allocations_per_iteration\": %.3f, \"bytes_per_iteration\": %.1f",
+                items,
+                result.iterations,
+                result.ns_per_iteration,
+                result.ns_per_item,
+                result.allocations_per_iteration,
+                result.bytes_per_iteration);
+            for (std::size_t i = 0; i < counter_count; i++)
+            {
+                write_json_number(out, counter_names[i], counters[i]);
+            }
+            for (std::size_t i = 0; i < latency_names.size(); i++)
+            {
+                write_json_number(out, latency_names[i], latencies[i]);
+            }
+            std::fprintf(out, "}");
+            break;
+    }
+
+    ++written;
+    std::fflush(out);
+}
+
+void Reporter::finish()
+{
+    if (format == Format::json)
+    {
+        std::fprintf(out, "%s]\n}\n", written == 0 ? "" : "\n  ");
+    }
+    std::fflush(out);
+}
+
+}  // namespace vector::bench
@@ -0,0 +1,40 @@
+#pragma once
+#include "benchmark.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace vector::bench {
+
+enum class Format
+{
+    table,
+    csv,
+    json,
+};
+
+std::optional<Format> parse_format(std::string_view name);
+
+// Streams results as they complete. Counters that could not be measured, and latencies of benchmarks that do not
+// time their operations, are written as "-" in tables, empty fields in CSV and null in JSON; compare.py understands
+// the CSV and JSON forms.
+class Reporter
+{
+    std::FILE* out;
+    Format format;
+    std::size_t written = 0;
+
+   public:
+    Reporter(std::FILE* out, Format format);
+
+    Reporter(const Reporter&) = delete;
+    Reporter& operator=(const Reporter&) = delete;
+
+    void add(const std::string& name, std::size_t items, const Result& result);
+
+    void finish();
+};
+
+}  // namespace vector::bench
@@ -0,0 +1,119 @@
+#include "benchmark.hpp"
+#include <vector/sort.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// vector::sort against std::sort through Vector's iterators and over the raw buffer. Every iteration sorts a
+// fresh copy of the same random input; the copy is part of every variant.
+
+template <typename T>
+vector::Vector<T> random_input(std::size_t count)
+{
+    std::mt19937_64 rng(count);
+    vector::Vector<T> vec(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            vec.push_back(static_cast<T>(std::uniform_real_distribution<double>(-1e9, 1e9)(rng)));
+        }
+        else
+        {
+            vec.push_back(static_cast<T>(rng()));
+        }
+    }
+    return vec;
+}
+
+// One input per type and size, shared by all variants.
+template <typename T>
+const vector::Vector<T>& cached_input(std::size_t count)
+{
+    static std::map<std::size_t, vector::Vector<T>> inputs;
+    auto it = inputs.find(count);
+    if (it == inputs.end())
+    {
+        it = inputs.emplace(count, random_input<T>(count)).first;
+    }
+    return it->second;
+}
+
+template <typename T>
+vector::Vector<T> fresh_copy(std::size_t count)
+{
+    vector::Vector<T> vec = cached_input<T>(count);
+    static_cast<void>(vec.data());
+    return vec;
+}
+
+template <typename T>
+bool add_for(const std::string& type, std::size_t count)
+{
+    const std::string suffix = "/" + type + "/" + std::to_string(count);
+
+    if (count <= 1'000'000)
+    {
+        vector::bench::add("sort/std::sort_iterators" + suffix, count, [count] {
+            auto vec = fresh_copy<T>(count);
+            std::sort(vec.begin(), vec.end());
+            vector::bench::do_not_optimize(vec.data());
+        });
+    }
+
+    vector::bench::add("sort/std::sort_buffer" + suffix, count, [count] {
+        auto vec = fresh_copy<T>(count);
+        std::sort(vec.data(), vec.data() + vec.size());
+        vector::bench::do_not_optimize(vec.data());
+    });
+
+    return vector::bench::add("sort/vector::sort" + suffix, count, [count] {
+        auto vec = fresh_copy<T>(count);
+        vector::sort(vec);
+        vector::bench::do_not_optimize(vec.data());
+    });
+}
+
+bool add_key_value(std::size_t count)
+{
+    const std::string suffix = "/u64_u32/" + std::to_string(count);
+
+    vector::bench::add("sort/std::sort_pairs" + suffix, count, [count] {
+        const auto& keys = cached_input<std::uint64_t>(count);
+        std::vector<std::pair<std::uint64_t, std::uint32_t>> pairs;
+        pairs.reserve(count);
+        for (std::uint32_t i = 0; i < count; i++)
+        {
+            pairs.emplace_back(keys[i], i);
+        }
+        std::sort(pairs.begin(), pairs.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        vector::bench::do_not_optimize(pairs.data());
+    });
+
+    return vector::bench::add("sort/vector::sort_by_key" + suffix, count, [count] {
+        auto keys = fresh_copy<std::uint64_t>(count);
+        vector::Vector<std::uint32_t> values(count);
+        for (std::uint32_t i = 0; i < count; i++)
+        {
+            values.push_back(i);
+        }
+        vector::sort_by_key(keys, values);
+        vector::bench::do_not_optimize(keys.data());
+    });
+}
+
+bool add_sizes(std::size_t count)
+{
+    return add_for<std::uint32_t>("u32", count) && add_for<std::uint64_t>("u64", count)
+           && add_for<float>("float", count) && add_key_value(count);
+}
+
+const bool registered = add_sizes(10'000) && add_sizes(1'000'000) && add_sizes(4'000'000);
+
+}  // namespace
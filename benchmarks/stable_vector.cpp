@@ -0,0 +1,82 @@
+#include "benchmark.hpp"
+#include <vector/stable_vector.hpp>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace {
+
+// Growth latency tails: every push_back of a fresh container is timed on its own, so the p99 and max columns
+// show the calls that reallocate. Vector copies all elements on those calls; StableVector only allocates its
+// next segment. Indexed reads show what the segment lookup costs in exchange, and segment reads how much of it
+// iterating segment by segment wins back.
+
+// One filled container per type and size, shared by the read benchmarks.
+template <typename Container>
+const Container& filled(std::size_t count)
+{
+    static std::map<std::size_t, Container> containers;
+    auto it = containers.find(count);
+    if (it == containers.end())
+    {
+        Container vec;
+        for (std::uint64_t i = 0; i < count; i++)
+        {
+            vec.push_back(i);
+        }
+        it = containers.emplace(count, std::move(vec)).first;
+    }
+    return it->second;
+}
+
+template <typename Container>
+bool add_for(const std::string& container, std::size_t count)
+{
+    const std::string suffix = "/" + container + "/" + std::to_string(count);
+
+    vector::bench::add("stable_vector/push_back" + suffix, count, [count] {
+        Container vec;
+        for (std::uint64_t i = 0; i < count; i++)
+        {
+            vector::bench::timed([&vec, i] { vec.push_back(i); });
+        }
+        vector::bench::do_not_optimize(vec.size());
+    });
+
+    return vector::bench::add("stable_vector/indexed_read" + suffix, count, [count] {
+        const Container& vec = filled<Container>(count);
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            sum += vec[i];
+        }
+        vector::bench::do_not_optimize(sum);
+    });
+}
+
+bool add_segment_read(std::size_t count)
+{
+    return vector::bench::add("stable_vector/segment_read/StableVector/" + std::to_string(count), count, [count] {
+        const auto& vec = filled<vector::StableVector<std::uint64_t>>(count);
+        std::uint64_t sum = 0;
+        for (std::size_t segment = 0; segment < vec.segment_count(); segment++)
+        {
+            for (const std::uint64_t value : vec.segment(segment))
+            {
+                sum += value;
+            }
+        }
+        vector::bench::do_not_optimize(sum);
+    });
+}
+
+bool add_sizes(std::size_t count)
+{
+    return add_for<vector::Vector<std::uint64_t>>("Vector", count)
+           && add_for<vector::StableVector<std::uint64_t>>("StableVector", count) && add_segment_read(count);
+}
+
+const bool registered = add_sizes(1'000'000) && add_sizes(8'000'000);
+
+}  // namespace
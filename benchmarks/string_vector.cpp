@@ -0,0 +1,96 @@
+#include "benchmark.hpp"
+#include <vector/string_vector.hpp>
+#include <cstdint>
+#include <random>
+#include <string>
+
+namespace {
+
+// 1M strings of 8 to 40 characters, most of them too long for the small-string buffer. Building, scanning and
+// cloning a shared copy for writing (COW copy_storage) compare Vector<std::string> with StringVector.
+
+constexpr std::size_t elements = 1'000'000;
+
+const vector::Vector<std::string>& words()
+{
+    static const vector::Vector<std::string> cached = [] {
+        std::mt19937_64 rng(42);
+        vector::Vector<std::string> values(elements);
+        for (std::size_t i = 0; i < elements; i++)
+        {
+            values.emplace_back(8 + rng() % 33, static_cast<char>('a' + rng() % 26));
+        }
+        return values;
+    }();
+    return cached;
+}
+
+const vector::StringVector& packed()
+{
+    static const vector::StringVector cached(words());
+    return cached;
+}
+
+template <typename Container>
+std::uint64_t checksum(const Container& values)
+{
+    std::uint64_t sum = 0;
+    for (const auto& value : values)
+    {
+        sum += value.size() + static_cast<unsigned char>(value.back());
+    }
+    return sum;
+}
+
+bool add_build()
+{
+    vector::bench::add("string_vector/build/Vector<std::string>", elements, [] {
+        const auto& source = words();
+        vector::Vector<std::string> values;
+        for (std::size_t i = 0; i < source.size(); i++)
+        {
+            values.push_back(source[i]);
+        }
+        vector::bench::do_not_optimize(values.size());
+    });
+
+    return vector::bench::add("string_vector/build/StringVector", elements, [] {
+        const auto& source = words();
+        vector::StringVector values;
+        for (std::size_t i = 0; i < source.size(); i++)
+        {
+            values.push_back(source[i]);
+        }
+        vector::bench::do_not_optimize(values.size());
+    });
+}
+
+bool add_scan()
+{
+    vector::bench::add("string_vector/scan/Vector<std::string>", elements, [] {
+        vector::bench::do_not_optimize(checksum(words()));
+    });
+
+    return vector::bench::add("string_vector/scan/StringVector", elements, [] {
+        vector::bench::do_not_optimize(checksum(packed()));
+    });
+}
+
+bool add_clone()
+{
+    vector::bench::add("string_vector/clone/Vector<std::string>", elements, [] {
+        vector::Vector<std::string> copy = words();
+        copy[0] = "changed";
+        vector::bench::do_not_optimize(copy.size());
+    });
+
+    return vector::bench::add("string_vector/clone/StringVector", elements, [] {
+        vector::StringVector copy = packed();
+        copy.assign(0, "changed");
+        vector::bench::do_not_optimize(copy.size());
+    });
+}
+
+const bool registered = add_build() && add_scan() && add_clone();
+
+}  // namespace
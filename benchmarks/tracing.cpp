@@ -0,0 +1,81 @@
+#include "benchmark.hpp"
+#include <vector/tracing.hpp>
+#include <cstdint>
+
+namespace {
+
+// The same workloads on an untraced element type and on one routed to HistogramSink: growing a vector from empty
+// (one reallocate and one destroy per doubling) and detaching many small shared vectors (one detach per write).
+
+struct Plain
+{
+    std::uint64_t value;
+};
+
+struct Traced
+{
+    std::uint64_t value;
+};
+
+}  // namespace
+
+template <>
+struct vector::trace::Hook<Traced>
+{
+    using type = vector::trace::HistogramSink;
+};
+
+#include <vector/vector.hpp>
+
+namespace {
+
+constexpr std::size_t elements = 1'000'000;
+constexpr std::size_t vectors = 10'000;
+
+template <typename T>
+void grow()
+{
+    const vector::trace::Site site;
+    vector::Vector<T> values;
+    for (std::size_t i = 0; i < elements; i++)
+    {
+        values.push_back({i});
+    }
+    vector::bench::do_not_optimize(values.size());
+}
+
+template <typename T>
+void detach()
+{
+    const vector::trace::Site site;
+    vector::Vector<T> source;
+    for (std::size_t i = 0; i < 16; i++)
+    {
+        source.push_back({i});
+    }
+
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < vectors; i++)
+    {
+        vector::Vector<T> copy = source;
+        copy.data()[0].value = i;
+        sum += std::as_const(copy).data()[0].value;
+    }
+    vector::bench::do_not_optimize(sum);
+}
+
+bool add_grow()
+{
+    vector::bench::add("tracing/grow/untraced", elements, grow<Plain>);
+    return vector::bench::add("tracing/grow/HistogramSink", elements, grow<Traced>);
+}
+
+bool add_detach()
+{
+    vector::bench::add("tracing/detach/untraced", vectors, detach<Plain>);
+    return vector::bench::add("tracing/detach/HistogramSink", vectors, detach<Traced>);
+}
+
+const bool registered = add_grow() && add_detach();
+
+}  // namespace
@@ -0,0 +1,107 @@
+#include "benchmark.hpp"
+#include <vector/views.hpp>
+#include <cstdint>
+#include <ranges>
+#include <span>
+
+namespace {
+
+// Chained transformations built with lazy views and one collect(), against materializing a Vector after every
+// step (reserving wherever the size is known) and against the C++20 standard views where they exist.
+
+constexpr std::size_t elements = 100'000;
+
+const vector::Vector<std::uint64_t>& input()
+{
+    static const vector::Vector<std::uint64_t> values = [] {
+        vector::Vector<std::uint64_t> vec(elements);
+        for (std::size_t i = 0; i < elements; i++)
+        {
+            vec.push_back(i * 2654435761U % 1'000'003);
+        }
+        return vec;
+    }();
+    return values;
+}
+
+constexpr auto scale = [](std::uint64_t x) { return x * 3 + 1; };
+constexpr auto keep = [](std::uint64_t x) { return x % 4 != 0; };
+constexpr auto fold = [](std::uint64_t x) { return x ^ (x >> 7); };
+
+bool add_map_filter_map()
+{
+    vector::bench::add("views/map_filter_map/materialized", elements, [] {
+        const vector::Vector<std::uint64_t>& values = input();
+
+        vector::Vector<std::uint64_t> scaled(values.size());
+        for (const std::uint64_t x : vector::views::all(values))
+        {
+            scaled.push_back(scale(x));
+        }
+        vector::Vector<std::uint64_t> kept;
+        for (const std::uint64_t x : vector::views::all(scaled))
+        {
+            if (keep(x))
+            {
+                kept.push_back(x);
+            }
+        }
+        vector::Vector<std::uint64_t> folded(kept.size());
+        for (const std::uint64_t x : vector::views::all(kept))
+        {
+            folded.push_back(fold(x));
+        }
+        vector::bench::do_not_optimize(folded.size());
+    });
+
+    vector::bench::add("views/map_filter_map/fused", elements, [] {
+        const auto folded = input() | vector::views::transform(scale) | vector::views::filter(keep)
+                            | vector::views::transform(fold) | vector::collect();
+        vector::bench::do_not_optimize(folded.size());
+    });
+
+    return vector::bench::add("views/map_filter_map/std::views", elements, [] {
+        const vector::Vector<std::uint64_t>& values = input();
+        const std::span<const std::uint64_t> span(values.data(), values.size());
+
+        vector::Vector<std::uint64_t> folded;
+        for (const std::uint64_t x :
+             span | std::views::transform(scale) | std::views::filter(keep) | std::views::transform(fold))
+        {
+            folded.push_back(x);
+        }
+        vector::bench::do_not_optimize(folded.size());
+    });
+}
+
+// A sized pipeline, for which collect() allocates the result once.
+bool add_zip_stride()
+{
+    vector::bench::add("views/zip_stride/materialized", elements, [] {
+        const vector::Vector<std::uint64_t>& values = input();
+
+        vector::Vector<std::uint64_t> strided((values.size() + 1) / 2);
+        for (std::size_t i = 0; i < values.size(); i += 2)
+        {
+            strided.push_back(values[i]);
+        }
+        vector::Vector<std::uint64_t> sums(strided.size());
+        for (std::size_t i = 0; i < strided.size(); i++)
+        {
+            sums.push_back(values[i] + strided[i]);
+        }
+        vector::bench::do_not_optimize(sums.size());
+    });
+
+    return vector::bench::add("views/zip_stride/fused", elements, [] {
+        const vector::Vector<std::uint64_t>& values = input();
+        const auto sums = vector::views::zip(values, values | vector::views::stride(2))
+                          | vector::views::transform([](const auto& pair) { return pair.first + pair.second; })
+                          | vector::collect();
+        vector::bench::do_not_optimize(sums.size());
+    });
+}
+
+const bool registered = add_map_filter_map() && add_zip_stride();
+
+}  // namespace
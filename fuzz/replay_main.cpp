@@ -0,0 +1,58 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+// Runs a fuzz target over files and directories of inputs without libFuzzer, so the checked-in corpus doubles
+// as a regression test on any compiler.
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size);
+
+namespace {
+
+void replay(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    const std::vector<char> bytes{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    LLVMFuzzerTestOneInput(reinterpret_cast<const std::uint8_t*>(bytes.data()), bytes.size());
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t inputs = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const std::filesystem::path path(argv[i]);
+
+        if (std::filesystem::is_directory(path))
+        {
+            for (const auto& entry : std::filesystem::directory_iterator(path))
+            {
+                if (entry.is_regular_file())
+                {
+                    replay(entry.path());
+                    ++inputs;
+                }
+            }
+        }
+        else if (std::filesystem::is_regular_file(path))
+        {
+            replay(path);
+            ++inputs;
+        }
+        else
+        {
+            std::fprintf(stderr, "%s: no such file or directory\n", argv[i]);
+            return 1;
+        }
+    }
+
+    std::printf("replayed %zu inputs\n", inputs);
+    return inputs == 0 ? 1 : 0;
+}
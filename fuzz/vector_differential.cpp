@@ -0,0 +1,426 @@
+#include <vector/vector.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <span>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// Differential fuzz target: replays an operation sequence decoded from the input on a few vector::Vector
+// instances and on std::vector models of them, and after every step checks that contents match and that the
+// number of live elements equals the elements held by distinct buffers (shared copy-on-write buffers count
+// once), which catches leaks, double destroys and writes leaking into shared copies.
+
+namespace {
+
+[[noreturn]] void fail(const char* what, std::size_t step)
+{
+    std::fprintf(stderr, "vector_differential: %s (step %zu)\n", what, step);
+    std::abort();
+}
+
+// Element type that counts live objects and detects use after destruction.
+struct Tracked
+{
+    static constexpr std::uint32_t alive_magic = 0x600DF00D;
+    static constexpr std::uint32_t dead_magic = 0xDEADBEEF;
+    static inline std::int64_t alive = 0;
+
+    int value;
+    std::uint32_t magic = alive_magic;
+
+    explicit Tracked(int value = 0) : value(value)
+    {
+        ++alive;
+    }
+    Tracked(const Tracked& other) : value(other.checked())
+    {
+        ++alive;
+    }
+    Tracked(Tracked&& other) noexcept : value(other.checked())
+    {
+        ++alive;
+    }
+    Tracked& operator=(const Tracked& other)
+    {
+        static_cast<void>(checked());
+        value = other.checked();
+        return *this;
+    }
+    Tracked& operator=(Tracked&& other) noexcept
+    {
+        static_cast<void>(checked());
+        value = other.checked();
+        return *this;
+    }
+    ~Tracked()
+    {
+        static_cast<void>(checked());
+        magic = dead_magic;
+        --alive;
+    }
+
+    [[nodiscard]] int checked() const
+    {
+        if (magic != alive_magic)
+        {
+            fail("use of a destroyed element", 0);
+        }
+        return value;
+    }
+
+    friend bool operator==(const Tracked& lhs, const Tracked& rhs)
+    {
+        return lhs.checked() == rhs.checked();
+    }
+};
+
+constexpr std::size_t slot_count = 4;
+constexpr std::size_t max_size = 256;
+
+// Consumes the fuzzer input a byte at a time; reads past the end yield zeros.
+class Input
+{
+    std::span<const std::uint8_t> data;
+
+   public:
+    explicit Input(std::span<const std::uint8_t> data) : data(data)
+    {
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return data.empty();
+    }
+
+    std::uint8_t byte() noexcept
+    {
+        if (data.empty())
+        {
+            return 0;
+        }
+        const std::uint8_t value = data.front();
+        data = data.subspan(1);
+        return value;
+    }
+
+    // Uniform-ish in [0, bound]; bound must be below 65536.
+    std::size_t upto(std::size_t bound) noexcept
+    {
+        const std::size_t raw = (std::size_t{byte()} << 8) | byte();
+        return raw % (bound + 1);
+    }
+
+    int value() noexcept
+    {
+        return static_cast<int>(byte()) - 128;
+    }
+};
+
+struct Slots
+{
+    std::array<vector::Vector<Tracked>, slot_count> vectors;
+    std::array<std::vector<int>, slot_count> models;
+};
+
+void check(const Slots& slots, std::size_t step)
+{
+    std::unordered_set<const Tracked*> buffers;
+    std::int64_t expected_alive = 0;
+
+    for (std::size_t s = 0; s < slot_count; s++)
+    {
+        const vector::Vector<Tracked>& vec = slots.vectors[s];
+        const std::vector<int>& model = slots.models[s];
+
+        if (vec.size() != model.size())
+        {
+            fail("size mismatch", step);
+        }
+        if (vec.size() > vec.capacity())
+        {
+            fail("size exceeds capacity", step);
+        }
+
+        const Tracked* data = vec.data();
+        for (std::size_t i = 0; i < model.size(); i++)
+        {
+            if (data[i].checked() != model[i])
+            {
+                fail("content mismatch", step);
+            }
+        }
+
+        if (buffers.insert(data).second)
+        {
+            expected_alive += static_cast<std::int64_t>(vec.size());
+        }
+    }
+
+    if (Tracked::alive != expected_alive)
+    {
+        fail("live element count does not match contents", step);
+    }
+}
+
+void apply(Slots& slots, Input& input, std::size_t step)
+{
+    const std::size_t s = input.byte() % slot_count;
+    vector::Vector<Tracked>& vec = slots.vectors[s];
+    std::vector<int>& model = slots.models[s];
+    const std::size_t size = model.size();
+    const bool can_grow = size < max_size;
+
+    switch (input.byte() % 24)
+    {
+        case 0:
+            if (can_grow)
+            {
+                const int value = input.value();
+                vec.push_back(Tracked(value));
+                model.push_back(value);
+            }
+            break;
+        case 1:
+            if (can_grow)
+            {
+                const int value = input.value();
+                const Tracked copy(value);
+                vec.push_back(copy);
+                model.push_back(value);
+            }
+            break;
+        case 2:
+            if (can_grow)
+            {
+                const int value = input.value();
+                vec.emplace_back(value);
+                model.emplace_back(value);
+            }
+            break;
+        case 3:
+            // Appends a copy of one of its own elements, which may be relocated by the growth.
+            if (can_grow && (size != 0))
+            {
+                const std::size_t index = input.upto(size - 1);
+                vec.emplace_back(std::as_const(vec)[index]);
+                model.push_back(model[index]);
+            }
+            break;
+        case 4:
+            if (size != 0)
+            {
+                vec.pop_back();
+                model.pop_back();
+            }
+            break;
+        case 5:
+            if (can_grow)
+            {
+                const std::size_t index = input.upto(size);
+                const int value = input.value();
+                vec.insert(vec.begin() + index, Tracked(value));
+                model.insert(model.begin() + static_cast<std::ptrdiff_t>(index), value);
+            }
+            break;
+        case 6:
+            // Inserts a copy of one of its own elements.
+            if (can_grow && (size != 0))
+            {
+                const std::size_t index = input.upto(size);
+                const std::size_t source = input.upto(size - 1);
+                const int value = model[source];
+                vec.insert(vec.begin() + index, std::as_const(vec)[source]);
+                model.insert(model.begin() + static_cast<std::ptrdiff_t>(index), value);
+            }
+            break;
+        case 7:
+        {
+            const std::size_t index = input.upto(size);
+            const std::size_t count = input.upto(std::min<std::size_t>(max_size - size, 16));
+            const int value = input.value();
+            vec.insert(vec.begin() + index, count, Tracked(value));
+            model.insert(model.begin() + static_cast<std::ptrdiff_t>(index), count, value);
+            break;
+        }
+        case 8:
+        {
+            const std::size_t index = input.upto(size);
+            const std::size_t count = input.upto(std::min<std::size_t>(max_size - size, 16));
+            std::vector<Tracked> values;
+            std::vector<int> model_values;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                values.emplace_back(input.value());
+                model_values.push_back(values.back().value);
+            }
+            vec.insert(vec.begin() + index, values.begin(), values.end());
+            model.insert(model.begin() + static_cast<std::ptrdiff_t>(index), model_values.begin(), model_values.end());
+            break;
+        }
+        case 9:
+            // Inserts a range of another (possibly the same) slot through Vector iterators.
+        {
+            const std::size_t from = input.byte() % slot_count;
+            vector::Vector<Tracked>& other = slots.vectors[from];
+            const std::vector<int> other_model = slots.models[from];
+            const std::size_t first = input.upto(other_model.size());
+            const std::size_t last = first + input.upto(other_model.size() - first);
+            const std::size_t index = input.upto(size);
+
+            if (size + (last - first) <= max_size)
+            {
+                vec.insert(vec.begin() + index, other.begin() + first, other.begin() + last);
+                model.insert(
+                    model.begin() + static_cast<std::ptrdiff_t>(index),
+                    other_model.begin() + static_cast<std::ptrdiff_t>(first),
+                    other_model.begin() + static_cast<std::ptrdiff_t>(last));
+            }
+            break;
+        }
+        case 10:
+            if (size != 0)
+            {
+                const std::size_t index = input.upto(size - 1);
+                vec.erase(vec.begin() + index);
+                model.erase(model.begin() + static_cast<std::ptrdiff_t>(index));
+            }
+            break;
+        case 11:
+        {
+            const std::size_t first = input.upto(size);
+            const std::size_t last = first + input.upto(size - first);
+            vec.erase(vec.begin() + first, vec.begin() + last);
+            model.erase(
+                model.begin() + static_cast<std::ptrdiff_t>(first), model.begin() + static_cast<std::ptrdiff_t>(last));
+            break;
+        }
+        case 12:
+        {
+            const std::size_t count = input.upto(max_size);
+            vec.resize(count);
+            model.resize(count);
+            break;
+        }
+        case 13:
+        {
+            const std::size_t count = input.upto(max_size);
+            const int value = input.value();
+            vec.resize(count, Tracked(value));
+            model.resize(count, value);
+            break;
+        }
+        case 14:
+            vec.reserve(input.upto(2 * max_size));
+            break;
+        case 15:
+            vec.shrink_to_fit();
+            break;
+        case 16:
+            vec.clear();
+            model.clear();
+            break;
+        case 17:
+        {
+            // Copy shares the buffer until either side writes.
+            const std::size_t from = input.byte() % slot_count;
+            vec = slots.vectors[from];
+            model = slots.models[from];
+            break;
+        }
+        case 18:
+        {
+            const std::size_t other = input.byte() % slot_count;
+            vec.swap(slots.vectors[other]);
+            model.swap(slots.models[other]);
+            break;
+        }
+        case 19:
+            // Copy-on-write writes through operator[] and at().
+            if (size != 0)
+            {
+                const std::size_t index = input.upto(size - 1);
+                const int value = input.value();
+                if (input.byte() % 2 == 0)
+                {
+                    vec[index] = Tracked(value);
+                }
+                else
+                {
+                    vec.at(index).value = value;
+                }
+                model[index] = value;
+            }
+            break;
+        case 20:
+        {
+            const int threshold = input.value();
+            const auto pred = [threshold](const Tracked& elem) { return elem.checked() < threshold; };
+            const std::size_t removed = vec.erase_if(pred);
+            if (removed != std::erase_if(model, [threshold](int value) { return value < threshold; }))
+            {
+                fail("erase_if count mismatch", step);
+            }
+            break;
+        }
+        case 21:
+            if (size != 0)
+            {
+                const std::size_t index = input.upto(size - 1);
+                vec.swap_remove(vec.begin() + index);
+                model[index] = model.back();
+                model.pop_back();
+            }
+            break;
+        case 22:
+        {
+            std::vector<std::size_t> indices;
+            for (std::size_t i = 0; i < size; i++)
+            {
+                if (input.byte() % 4 == 0)
+                {
+                    indices.push_back(i);
+                }
+            }
+            vec.erase_indices(indices);
+            for (auto it = indices.rbegin(); it != indices.rend(); ++it)
+            {
+                model.erase(model.begin() + static_cast<std::ptrdiff_t>(*it));
+            }
+            break;
+        }
+        case 23:
+        {
+            vector::Vector<Tracked> moved(std::move(vec));
+            vec = vector::Vector<Tracked>();
+            vec.swap(moved);
+            break;
+        }
+    }
+}
+
+}  // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)
+{
+    {
+        Slots slots;
+        Input input(std::span<const std::uint8_t>(data, size));
+
+        for (std::size_t step = 1; !input.empty(); step++)
+        {
+            apply(slots, input, step);
+            check(slots, step);
+        }
+    }
+
+    if (Tracked::alive != 0)
+    {
+        fail("elements leaked after destroying all vectors", 0);
+    }
+    return 0;
+}
@@ -0,0 +1,159 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <algorithm>
+
+namespace vector {
+
+// Monotonic bump allocator. Individual deallocations are no-ops unless they hit the most recent
+// allocation; all memory is returned at once when the arena is released or destroyed, so the arena
+// must outlive every container that allocates from it.
+class Arena
+{
+    struct Chunk
+    {
+        Chunk* prev;
+        std::size_t size;
+    };
+
+    static constexpr std::size_t header_size
+        = (sizeof(Chunk) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+    Chunk* chunks = nullptr;
+    std::byte* cursor = nullptr;
+    std::byte* limit = nullptr;
+    std::byte* last = nullptr;
+    std::size_t next_chunk_size;
+    std::size_t used = 0;
+
+    void add_chunk(std::size_t min_size)
+    {
+        const std::size_t size = std::max(next_chunk_size, min_size);
+        auto* block = static_cast<std::byte*>(operator new(header_size + size));
+
+        chunks = new (block) Chunk{chunks, size};
+        cursor = block + header_size;
+        limit = cursor + size;
+        last = nullptr;
+        next_chunk_size = size * 2;
+    }
+
+   public:
+    static constexpr std::size_t default_chunk_size = 64 * 1024;
+
+    explicit Arena(std::size_t chunk_size = default_chunk_size) : next_chunk_size(std::max<std::size_t>(chunk_size, 1))
+    {
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena()
+    {
+        release();
+    }
+
+    [[nodiscard]] void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t))
+    {
+        void* ptr = cursor;
+        std::size_t space = limit - cursor;
+
+        if ((cursor == nullptr) || (std::align(alignment, bytes, ptr, space) == nullptr))
+        {
+            add_chunk(bytes + alignment);
+            ptr = cursor;
+            space = limit - cursor;
+            std::align(alignment, bytes, ptr, space);
+        }
+
+        last = static_cast<std::byte*>(ptr);
+        cursor = last + bytes;
+        used += bytes;
+        return ptr;
+    }
+
+    void deallocate(void* ptr, std::size_t bytes) noexcept
+    {
+        if ((ptr != nullptr) && (ptr == last) && (last + bytes == cursor))
+        {
+            cursor = last;
+            last = nullptr;
+            used -= bytes;
+        }
+    }
+
+    [[nodiscard]] bool try_expand(void* ptr, std::size_t old_bytes, std::size_t new_bytes) noexcept
+    {
+        if ((ptr == nullptr) || (ptr != last) || (last + old_bytes != cursor)
+            || (new_bytes > static_cast<std::size_t>(limit - last)))
+        {
+            return false;
+        }
+
+        cursor = last + new_bytes;
+        used += new_bytes - old_bytes;
+        return true;
+    }
+
+    void release() noexcept
+    {
+        while (chunks != nullptr)
+        {
+            Chunk* prev = chunks->prev;
+            operator delete(chunks);
+            chunks = prev;
+        }
+
+        cursor = nullptr;
+        limit = nullptr;
+        last = nullptr;
+        used = 0;
+    }
+
+    [[nodiscard]] std::size_t bytes_used() const noexcept
+    {
+        return used;
+    }
+};
+
+template <typename T>
+class ArenaAllocator
+{
+    Arena* arena;
+
+   public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena& arena) noexcept : arena(&arena)
+    {
+    }
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.resource())
+    {
+    }
+
+    [[nodiscard]] T* allocate(std::size_t count)
+    {
+        return static_cast<T*>(arena->allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t count) noexcept
+    {
+        arena->deallocate(ptr, sizeof(T) * count);
+    }
+
+    [[nodiscard]] Arena* resource() const noexcept
+    {
+        return arena;
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& rhs) const noexcept
+    {
+        return arena == rhs.resource();
+    }
+};
+
+}  // namespace vector
@@ -0,0 +1,573 @@
+#pragma once
+#include <algorithm>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <vector/ring_vector.hpp>
+#include <vector/vector.hpp>
+
+namespace vector {
+
+class Executor;
+
+// Coroutine run by an Executor. It starts suspended, is resumed by the executor it was spawned on, and keeps its
+// frame until the executor has seen it finish.
+class Task
+{
+   public:
+    struct promise_type
+    {
+        Executor* executor = nullptr;
+        std::exception_ptr error;
+
+        Task get_return_object() noexcept
+        {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            error = std::current_exception();
+        }
+    };
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+   private:
+    handle_type handle;
+
+    friend class Executor;
+
+    explicit Task(handle_type handle) noexcept : handle(handle)
+    {
+    }
+
+   public:
+    Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr))
+    {
+    }
+
+    Task& operator=(Task other) noexcept
+    {
+        std::swap(handle, other.handle);
+        return *this;
+    }
+
+    ~Task()
+    {
+        if (handle)
+        {
+            handle.destroy();
+        }
+    }
+};
+
+// Runs Tasks on the thread that calls run(). Other threads may wake tasks through schedule(), so tasks can wait on
+// channels whose other end uses the blocking API.
+class Executor
+{
+    std::mutex mutex;
+    std::condition_variable wake;
+    RingVector<Task::handle_type> runnable;
+    // Spawned tasks that have not finished.
+    std::vector<Task> tasks;
+
+   public:
+    Executor() = default;
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    void spawn(Task task)
+    {
+        const Task::handle_type handle = task.handle;
+        handle.promise().executor = this;
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back(std::move(task));
+            runnable.push_back(handle);
+        }
+        wake.notify_one();
+    }
+
+    // Queues a suspended task to be resumed by run(). Thread-safe.
+    void schedule(Task::handle_type handle)
+    {
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            runnable.push_back(handle);
+        }
+        wake.notify_one();
+    }
+
+    // Resumes runnable tasks until every spawned task has finished, sleeping while all of them wait on other
+    // threads. If a task lets an exception escape, run() rethrows it at once and the other tasks stay suspended.
+    void run()
+    {
+        for (;;)
+        {
+            Task::handle_type next;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [this] { return !runnable.empty() || tasks.empty(); });
+                if (tasks.empty())
+                {
+                    return;
+                }
+                next = runnable.front();
+                runnable.pop_front();
+            }
+
+            next.resume();
+            if (next.done())
+            {
+                const std::exception_ptr error = next.promise().error;
+                Task finished(nullptr);
+                {
+                    const std::lock_guard<std::mutex> lock(mutex);
+                    const auto it = std::find_if(
+                        tasks.begin(), tasks.end(), [next](const Task& task) { return task.handle == next; });
+                    finished = std::move(*it);
+                    *it = std::move(tasks.back());
+                    tasks.pop_back();
+                }
+                if (error)
+                {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+    }
+};
+
+// Bounded queue of Vector batches between producers and consumers, for moving records in groups of thousands so
+// that each lock and wake-up is paid once per batch. Batches are moved, never copied. Consumers hand their
+// drained batches back through recycle(), and send() leaves one of those in the producer's variable, so in steady
+// state the same few buffers circulate without allocating. Every operation exists as a blocking call and as a
+// co_await-able awaiter for Tasks; a waiting task is handed its batch or its free slot directly by the thread that
+// makes it available. Both sides may mix the two styles and run on any number of threads.
+template <typename T>
+class BatchChannel
+{
+    struct Waiter
+    {
+        Waiter* next = nullptr;
+        Task::handle_type handle;
+        // Whether the waiter is in a wait list; guarded by the channel mutex.
+        bool enlisted = false;
+        bool suspended = false;
+    };
+
+    // FIFO of suspended awaiters, linked through the awaiters themselves.
+    class WaitList
+    {
+        Waiter* head = nullptr;
+        Waiter* tail = nullptr;
+
+       public:
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return head == nullptr;
+        }
+
+        void push(Waiter* waiter) noexcept
+        {
+            waiter->next = nullptr;
+            waiter->enlisted = true;
+            (tail == nullptr ? head : tail->next) = waiter;
+            tail = waiter;
+        }
+
+        Waiter* pop() noexcept
+        {
+            Waiter* waiter = head;
+            head = waiter->next;
+            if (head == nullptr)
+            {
+                tail = nullptr;
+            }
+            waiter->enlisted = false;
+            return waiter;
+        }
+
+        void remove(Waiter* waiter) noexcept
+        {
+            Waiter* previous = nullptr;
+            for (Waiter* it = head; it != waiter; it = it->next)
+            {
+                previous = it;
+            }
+            (previous == nullptr ? head : previous->next) = waiter->next;
+            if (tail == waiter)
+            {
+                tail = previous;
+            }
+            waiter->enlisted = false;
+        }
+    };
+
+    struct SendWaiter : Waiter
+    {
+        Vector<T>* batch = nullptr;
+        bool sent = false;
+        // The batch was taken and no recycled buffer was left in its place. A sender woken by a receiver looks
+        // again when it resumes, by which time that receiver has usually recycled one.
+        bool refill = false;
+    };
+
+    struct ReceiveWaiter : Waiter
+    {
+        std::optional<Vector<T>> result;
+    };
+
+    std::size_t limit;
+    mutable std::mutex mutex;
+    std::condition_variable not_full;
+    std::condition_variable not_empty;
+    RingVector<Vector<T>> queue;
+    RingVector<Vector<T>> spare;
+    WaitList senders;
+    WaitList receivers;
+    bool is_closed = false;
+
+    static void resume(Waiter* waiter)
+    {
+        waiter->handle.promise().executor->schedule(waiter->handle);
+    }
+
+    // Moves the batch out and puts a recycled buffer in its place when there is one; returns false when the
+    // caller still has to give it a fresh Vector.
+    bool take_locked(Vector<T>& batch)
+    {
+        Vector<T> taken = std::move(batch);
+        const bool recycled = !spare.empty();
+        if (recycled)
+        {
+            batch = std::move(spare.back());
+            spare.pop_back();
+        }
+
+        if (!receivers.empty())
+        {
+            auto* receiver = static_cast<ReceiveWaiter*>(receivers.pop());
+            receiver->result.emplace(std::move(taken));
+            resume(receiver);
+        }
+        else
+        {
+            queue.push_back(std::move(taken));
+            not_empty.notify_one();
+        }
+        return recycled;
+    }
+
+    Vector<T> pop_locked()
+    {
+        Vector<T> batch = std::move(queue.front());
+        queue.pop_front();
+
+        if (!senders.empty())
+        {
+            auto* sender = static_cast<SendWaiter*>(senders.pop());
+            sender->sent = true;
+            sender->refill = !take_locked(*sender->batch);
+            resume(sender);
+        }
+        else
+        {
+            not_full.notify_one();
+        }
+        return batch;
+    }
+
+    // A recycled buffer if one is available, otherwise a new Vector allocated outside the lock.
+    Vector<T> spare_or_new()
+    {
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            if (!spare.empty())
+            {
+                Vector<T> batch = std::move(spare.back());
+                spare.pop_back();
+                return batch;
+            }
+        }
+        return Vector<T>();
+    }
+
+    // Suspended awaiters destroyed along with their task leave the wait list instead of dangling in it.
+    void forget(Waiter& waiter, WaitList& list) noexcept
+    {
+        if (waiter.suspended)
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            if (waiter.enlisted)
+            {
+                list.remove(&waiter);
+            }
+        }
+    }
+
+   public:
+    using value_type = T;
+
+    class SendAwaiter
+    {
+        BatchChannel* channel;
+        SendWaiter waiter;
+
+        friend class BatchChannel;
+
+        SendAwaiter(BatchChannel* channel, Vector<T>& batch) : channel(channel)
+        {
+            waiter.batch = &batch;
+        }
+
+       public:
+        SendAwaiter(const SendAwaiter&) = delete;
+        SendAwaiter& operator=(const SendAwaiter&) = delete;
+
+        ~SendAwaiter()
+        {
+            channel->forget(waiter, channel->senders);
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(Task::handle_type handle)
+        {
+            const std::lock_guard<std::mutex> lock(channel->mutex);
+            if (channel->is_closed)
+            {
+                return false;
+            }
+            if (channel->queue.size() < channel->limit)
+            {
+                waiter.sent = true;
+                waiter.refill = !channel->take_locked(*waiter.batch);
+                return false;
+            }
+
+            waiter.handle = handle;
+            waiter.suspended = true;
+            channel->senders.push(&waiter);
+            return true;
+        }
+
+        // Whether the batch was sent; false if the channel was closed, and the batch is then left as it was.
+        bool await_resume()
+        {
+            if (waiter.refill)
+            {
+                *waiter.batch = channel->spare_or_new();
+            }
+            return waiter.sent;
+        }
+    };
+
+    class ReceiveAwaiter
+    {
+        BatchChannel* channel;
+        ReceiveWaiter waiter;
+
+        friend class BatchChannel;
+
+        explicit ReceiveAwaiter(BatchChannel* channel) : channel(channel)
+        {
+        }
+
+       public:
+        ReceiveAwaiter(const ReceiveAwaiter&) = delete;
+        ReceiveAwaiter& operator=(const ReceiveAwaiter&) = delete;
+
+        ~ReceiveAwaiter()
+        {
+            channel->forget(waiter, channel->receivers);
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(Task::handle_type handle)
+        {
+            const std::lock_guard<std::mutex> lock(channel->mutex);
+            if (!channel->queue.empty())
+            {
+                waiter.result.emplace(channel->pop_locked());
+                return false;
+            }
+            if (channel->is_closed)
+            {
+                return false;
+            }
+
+            waiter.handle = handle;
+            waiter.suspended = true;
+            channel->receivers.push(&waiter);
+            return true;
+        }
+
+        // The next batch, or nullopt once the channel is closed and drained.
+        std::optional<Vector<T>> await_resume()
+        {
+            return std::move(waiter.result);
+        }
+    };
+
+    // Holds up to `capacity` batches. It keeps one recycled buffer more than that, enough to refill every batch
+    // that is queued or being consumed.
+    explicit BatchChannel(std::size_t capacity)
+        : limit(std::max<std::size_t>(capacity, 1)), queue(limit), spare(limit + 1)
+    {
+    }
+
+    BatchChannel(const BatchChannel&) = delete;
+    BatchChannel& operator=(const BatchChannel&) = delete;
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return limit;
+    }
+
+    // Batches waiting to be received.
+    [[nodiscard]] std::size_t size() const
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        return queue.size();
+    }
+
+    [[nodiscard]] bool closed() const
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        return is_closed;
+    }
+
+    // Moves `batch` into the channel, waiting while it is full, and leaves an empty, possibly recycled Vector in
+    // its place. Returns false without touching `batch` if the channel is closed.
+    bool send(Vector<T>& batch)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        not_full.wait(lock, [this] { return is_closed || (queue.size() < limit); });
+        if (is_closed)
+        {
+            return false;
+        }
+
+        const bool recycled = take_locked(batch);
+        lock.unlock();
+        if (!recycled)
+        {
+            batch = Vector<T>();
+        }
+        return true;
+    }
+
+    // Like send(), but returns false instead of waiting when the channel is full.
+    bool try_send(Vector<T>& batch)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (is_closed || (queue.size() == limit))
+        {
+            return false;
+        }
+
+        const bool recycled = take_locked(batch);
+        lock.unlock();
+        if (!recycled)
+        {
+            batch = Vector<T>();
+        }
+        return true;
+    }
+
+    // The next batch, waiting while the channel is empty; nullopt once it is closed and drained.
+    std::optional<Vector<T>> receive()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        not_empty.wait(lock, [this] { return is_closed || !queue.empty(); });
+        if (queue.empty())
+        {
+            return std::nullopt;
+        }
+        return pop_locked();
+    }
+
+    // Like receive(), but returns nullopt instead of waiting when the channel is empty.
+    std::optional<Vector<T>> try_receive()
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (queue.empty())
+        {
+            return std::nullopt;
+        }
+        return pop_locked();
+    }
+
+    // co_await channel.async_send(batch) from a Task: the awaiting form of send().
+    [[nodiscard]] SendAwaiter async_send(Vector<T>& batch)
+    {
+        return SendAwaiter(this, batch);
+    }
+
+    // co_await channel.async_receive() from a Task: the awaiting form of receive().
+    [[nodiscard]] ReceiveAwaiter async_receive()
+    {
+        return ReceiveAwaiter(this);
+    }
+
+    // Gives a consumed batch's buffer back for send() to hand to a producer. The elements are destroyed here,
+    // outside the lock. Buffers beyond what the channel can refill are freed.
+    void recycle(Vector<T> batch)
+    {
+        batch.clear();
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (spare.size() <= limit)
+        {
+            spare.push_back(std::move(batch));
+        }
+    }
+
+    // Stops further sends; receivers drain what is queued and then get nullopt. Wakes every waiter.
+    void close()
+    {
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            is_closed = true;
+            while (!senders.empty())
+            {
+                resume(senders.pop());
+            }
+            while (!receivers.empty())
+            {
+                resume(receivers.pop());
+            }
+        }
+        not_full.notify_all();
+        not_empty.notify_all();
+    }
+};
+
+}  // namespace vector
@@ -0,0 +1,385 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector/vector.hpp>
+
+namespace vector {
+
+namespace detail {
+
+inline constexpr std::size_t compressed_block = 128;
+
+// Extracts 128 values of `Width` bits packed back to back into 2 * Width words. The width is a template parameter
+// so the shifts and word indices are constants the compiler can unroll and vectorize.
+template <typename U, std::size_t Width>
+void unpack_block(const std::uint64_t* in, U* out) noexcept
+{
+    if constexpr (Width == 0)
+    {
+        std::fill_n(out, compressed_block, U{0});
+    }
+    else
+    {
+        constexpr std::uint64_t mask = Width == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << Width) - 1;
+        // Every 64 values end on a word boundary.
+        for (std::size_t half = 0; half < 2; half++)
+        {
+            const std::uint64_t* words = in + half * Width;
+            U* values = out + half * 64;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC unroll 64
+#endif
+            for (std::size_t i = 0; i < 64; i++)
+            {
+                const std::size_t bit = i * Width;
+                const std::size_t shift = bit % 64;
+                std::uint64_t value = words[bit / 64] >> shift;
+                if (shift + Width > 64)
+                {
+                    value |= words[bit / 64 + 1] << (64 - shift);
+                }
+                values[i] = static_cast<U>(value & mask);
+            }
+        }
+    }
+}
+
+template <typename U>
+using Unpacker = void (*)(const std::uint64_t*, U*) noexcept;
+
+template <typename U, std::size_t... Widths>
+constexpr auto make_unpackers(std::index_sequence<Widths...> /*widths*/)
+{
+    return std::array<Unpacker<U>, sizeof...(Widths)>{&unpack_block<U, Widths>...};
+}
+
+template <typename U>
+inline constexpr auto unpackers = make_unpackers<U>(std::make_index_sequence<std::numeric_limits<U>::digits + 1>());
+
+// Packs 128 values of `width` bits into 2 * width words.
+template <typename U>
+void pack_block(const U* in, std::size_t width, std::uint64_t* out) noexcept
+{
+    if (width == 0)
+    {
+        return;
+    }
+
+    std::uint64_t word = 0;
+    std::size_t used = 0;
+    for (std::size_t i = 0; i < compressed_block; i++)
+    {
+        const auto value = static_cast<std::uint64_t>(in[i]);
+        word |= value << used;
+        used += width;
+        if (used >= 64)
+        {
+            *out++ = word;
+            used -= 64;
+            word = used == 0 ? 0 : value >> (width - used);
+        }
+    }
+}
+
+}  // namespace detail
+
+// Integers compressed in blocks of 128: each block stores its first value and the smallest difference between
+// neighbours, then every difference minus that smallest one bit-packed at the width of the largest. Sorted ID
+// lists with small gaps shrink to a few bits per value, and evenly spaced ones to the block header alone. Signed
+// or unsorted values work too, at a larger width. The partial last block stays uncompressed so that push_back
+// is cheap. Copies share their buffers like Vector does.
+template <std::integral T>
+class CompressedVector
+{
+    using U = std::make_unsigned_t<T>;
+    using S = std::make_signed_t<T>;
+
+   public:
+    static constexpr std::size_t block_size = detail::compressed_block;
+
+   private:
+    struct Block
+    {
+        U first;
+        U min_delta;
+        std::size_t offset;
+        std::size_t width;
+    };
+
+    Vector<std::uint64_t> words;
+    Vector<Block> blocks;
+    Vector<T> tail;
+
+    // Differences wrap around in the unsigned type, so signed values cannot overflow.
+    static U difference(T later, T earlier) noexcept
+    {
+        return static_cast<U>(static_cast<U>(later) - static_cast<U>(earlier));
+    }
+
+    // Header of the block starting at `values`; offset is filled in by the caller.
+    static Block describe(const T* values) noexcept
+    {
+        S min_delta = std::numeric_limits<S>::max();
+        for (std::size_t i = 1; i < block_size; i++)
+        {
+            min_delta = std::min(min_delta, static_cast<S>(difference(values[i], values[i - 1])));
+        }
+
+        U widest = 0;
+        for (std::size_t i = 1; i < block_size; i++)
+        {
+            widest |= static_cast<U>(difference(values[i], values[i - 1]) - static_cast<U>(min_delta));
+        }
+
+        const auto width = static_cast<std::size_t>(std::bit_width(widest));
+        return {static_cast<U>(values[0]), static_cast<U>(min_delta), 0, width};
+    }
+
+    static void encode(const T* values, const Block& block, std::uint64_t* out) noexcept
+    {
+        std::array<U, block_size> deltas{};
+        for (std::size_t i = 1; i < block_size; i++)
+        {
+            deltas[i] = static_cast<U>(difference(values[i], values[i - 1]) - block.min_delta);
+        }
+        detail::pack_block(deltas.data(), block.width, out);
+    }
+
+    void append_block(const T* values)
+    {
+        Block block = describe(values);
+        block.offset = words.size();
+
+        std::array<std::uint64_t, 2 * std::numeric_limits<U>::digits> packed{};
+        encode(values, block, packed.data());
+        words.append(packed.data(), packed.data() + 2 * block.width);
+        blocks.push_back(block);
+    }
+
+   public:
+    using value_type = T;
+
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+
+    CompressedVector() = default;
+
+    // Compresses all of `values` in two passes, so every buffer is allocated once at its final size.
+    explicit CompressedVector(const Vector<T>& values)
+    {
+        const std::size_t full = values.size() / block_size;
+        const T* data = values.data();
+
+        Vector<Block> headers(std::max<std::size_t>(full, 1));
+        std::size_t total = 0;
+        for (std::size_t b = 0; b < full; b++)
+        {
+            Block block = describe(data + b * block_size);
+            block.offset = total;
+            total += 2 * block.width;
+            headers.push_back(block);
+        }
+
+        words.overwrite(total, [&headers, data, full](std::uint64_t* out) {
+            for (std::size_t b = 0; b < full; b++)
+            {
+                const Block& block = std::as_const(headers)[b];
+                encode(data + b * block_size, block, out + block.offset);
+            }
+        });
+        blocks = std::move(headers);
+        tail.append(data + full * block_size, data + values.size());
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return blocks.size() * block_size + tail.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    // Bytes held by the buffers, including spare capacity.
+    [[nodiscard]] std::size_t memory_bytes() const noexcept
+    {
+        return words.capacity() * sizeof(std::uint64_t) + blocks.capacity() * sizeof(Block)
+               + tail.capacity() * sizeof(T);
+    }
+
+    void push_back(T value)
+    {
+        tail.push_back(value);
+        if (tail.size() == block_size)
+        {
+            append_block(std::as_const(tail).data());
+            tail.clear();
+        }
+    }
+
+    void clear()
+    {
+        words.clear();
+        blocks.clear();
+        tail.clear();
+    }
+
+    [[nodiscard]] std::size_t block_count() const noexcept
+    {
+        return blocks.size() + (tail.empty() ? 0 : 1);
+    }
+
+    // Writes the values of block `index` to out and returns how many there are: block_size for all but the last.
+    std::size_t decode_block(std::size_t index, T* out) const noexcept
+    {
+        if (index == blocks.size())
+        {
+            std::copy_n(tail.data(), tail.size(), out);
+            return tail.size();
+        }
+
+        const Block& block = blocks[index];
+        std::array<U, block_size> deltas;
+        detail::unpackers<U>[block.width](words.data() + block.offset, deltas.data());
+
+        U value = block.first;
+        out[0] = static_cast<T>(value);
+        for (std::size_t i = 1; i < block_size; i++)
+        {
+            value = static_cast<U>(value + deltas[i] + block.min_delta);
+            out[i] = static_cast<T>(value);
+        }
+        return block_size;
+    }
+
+    // Decodes only the block holding `pos`.
+    T operator[](std::size_t pos) const noexcept
+    {
+        const std::size_t index = pos / block_size;
+        if (index == blocks.size())
+        {
+            return tail[pos % block_size];
+        }
+
+        std::array<T, block_size> values;
+        decode_block(index, values.data());
+        return values[pos % block_size];
+    }
+
+    T at(std::size_t pos) const
+    {
+        if (!(pos < size()))
+        {
+            throw std::out_of_range("Pos out of range");
+        }
+        return (*this)[pos];
+    }
+
+    // Calls f(value) for every value in order, one decoded block at a time.
+    template <typename F>
+    void for_each(F f) const
+    {
+        std::array<T, block_size> values;
+        for (std::size_t index = 0; index < block_count(); index++)
+        {
+            const std::size_t count = decode_block(index, values.data());
+            for (std::size_t i = 0; i < count; i++)
+            {
+                f(values[i]);
+            }
+        }
+    }
+
+    [[nodiscard]] Vector<T> to_vector() const
+    {
+        Vector<T> result;
+        result.overwrite(size(), [this](T* out) {
+            for (std::size_t index = 0; index < block_count(); index++)
+            {
+                out += decode_block(index, out);
+            }
+        });
+        return result;
+    }
+
+    // Forward iterator that decodes a block when it enters it; dereferencing yields values, not references.
+    class Iterator
+    {
+        const CompressedVector* owner = nullptr;
+        std::size_t index = 0;
+        std::array<T, block_size> values{};
+
+        friend class CompressedVector;
+
+        Iterator(const CompressedVector* owner, std::size_t index) : owner(owner), index(index)
+        {
+            load();
+        }
+
+        void load() noexcept
+        {
+            if (index < owner->size())
+            {
+                owner->decode_block(index / block_size, values.data());
+            }
+        }
+
+       public:
+        using value_type = T;
+        using reference = T;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        Iterator() = default;
+
+        T operator*() const noexcept
+        {
+            return values[index % block_size];
+        }
+
+        Iterator& operator++() noexcept
+        {
+            ++index;
+            if (index % block_size == 0)
+            {
+                load();
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator it(*this);
+            ++*this;
+            return it;
+        }
+
+        bool operator==(const Iterator& rhs) const noexcept
+        {
+            return index == rhs.index;
+        }
+    };
+
+    const_iterator begin() const
+    {
+        return Iterator(this, 0);
+    }
+
+    const_iterator end() const
+    {
+        return Iterator(this, size());
+    }
+};
+
+}  // namespace vector
@@ -0,0 +1,275 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector/vector.hpp>
+
+namespace vector {
+
+// Uniquely owning (non copy-on-write) counterpart of Vector that is usable in constant expressions: it owns
+// its VecStorage directly, and VecStorage switches to std::allocator during constant evaluation.
+template <typename T>
+class ConstexprVector
+{
+    VecStorage<T> storage;
+
+    // Moves the elements into a buffer of `new_capacity` after `construct(place)` has built `count` new elements
+    // past them, so the new elements may be copied from old ones. `construct` must clean up after itself on
+    // exception.
+    template <typename Construct>
+    constexpr void reallocate_with(std::size_t new_capacity, std::size_t count, Construct construct)
+    {
+        VecStorage<T> new_storage(new_capacity);
+        construct(new_storage.data + size());
+
+        std::size_t moved = 0;
+        try
+        {
+            for (; moved < size(); moved++)
+            {
+                std::construct_at(new_storage.data + moved, std::move_if_noexcept(storage.data[moved]));
+            }
+        }
+        catch (...)
+        {
+            std::destroy_n(new_storage.data, moved);
+            std::destroy_n(new_storage.data + size(), count);
+            throw;
+        }
+        new_storage.size = size() + count;
+
+        storage.swap(new_storage);
+    }
+
+    constexpr void reallocate(std::size_t new_capacity)
+    {
+        reallocate_with(new_capacity, 0, [](T* /*place*/) {});
+    }
+
+    static constexpr void construct_copies(T* place, std::size_t count, const T& value)
+    {
+        std::size_t built = 0;
+        try
+        {
+            for (; built < count; built++)
+            {
+                std::construct_at(place + built, value);
+            }
+        }
+        catch (...)
+        {
+            std::destroy_n(place, built);
+            throw;
+        }
+    }
+
+   public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr ConstexprVector() = default;
+
+    constexpr explicit ConstexprVector(std::size_t capacity) : storage(capacity)
+    {
+    }
+
+    constexpr ConstexprVector(std::initializer_list<T> values) : storage(values.size())
+    {
+        for (const T& value : values)
+        {
+            push_back(value);
+        }
+    }
+
+    constexpr ConstexprVector(const ConstexprVector& other) = default;
+
+    constexpr ConstexprVector(ConstexprVector&& other) noexcept = default;
+
+    constexpr ConstexprVector& operator=(ConstexprVector other) noexcept
+    {
+        storage.swap(other.storage);
+        return *this;
+    }
+
+    constexpr void swap(ConstexprVector& other) noexcept
+    {
+        storage.swap(other.storage);
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return storage.size;
+    }
+
+    [[nodiscard]] constexpr std::size_t capacity() const noexcept
+    {
+        return storage.capacity;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return storage.size == 0;
+    }
+
+    [[nodiscard]] constexpr T* data() noexcept
+    {
+        return storage.data;
+    }
+
+    [[nodiscard]] constexpr const T* data() const noexcept
+    {
+        return storage.data;
+    }
+
+    constexpr iterator begin() noexcept
+    {
+        return storage.data;
+    }
+
+    constexpr iterator end() noexcept
+    {
+        return storage.data + storage.size;
+    }
+
+    constexpr const_iterator begin() const noexcept
+    {
+        return storage.data;
+    }
+
+    constexpr const_iterator end() const noexcept
+    {
+        return storage.data + storage.size;
+    }
+
+    constexpr const T& operator[](std::size_t pos) const
+    {
+        return storage.data[pos];
+    }
+
+    constexpr T& operator[](std::size_t pos)
+    {
+        return storage.data[pos];
+    }
+
+    constexpr const T& at(std::size_t pos) const
+    {
+        if (!(pos < size()))
+        {
+            throw std::out_of_range("Pos out of range");
+        }
+        return storage.data[pos];
+    }
+
+    constexpr T& at(std::size_t pos)
+    {
+        if (!(pos < size()))
+        {
+            throw std::out_of_range("Pos out of range");
+        }
+        return storage.data[pos];
+    }
+
+    constexpr void reserve(std::size_t new_capacity)
+    {
+        if (new_capacity > capacity())
+        {
+            reallocate(new_capacity);
+        }
+    }
+
+    // The arguments may refer to elements of this vector.
+    template <typename... Args>
+    constexpr T& emplace_back(Args&&... args)
+    {
+        if (size() == capacity())
+        {
+            reallocate_with(std::max<std::size_t>(capacity() * vector::factor, 1), 1, [&args...](T* place) {
+                std::construct_at(place, std::forward<Args>(args)...);
+            });
+            return storage.data[size() - 1];
+        }
+
+        T* place = std::construct_at(storage.data + size(), std::forward<Args>(args)...);
+        ++storage.size;
+        return *place;
+    }
+
+    constexpr void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    constexpr void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    constexpr void pop_back()
+    {
+        --storage.size;
+        std::destroy_at(storage.data + size());
+    }
+
+    constexpr void clear() noexcept
+    {
+        std::destroy_n(storage.data, size());
+        storage.size = 0;
+    }
+
+    // `value` may refer to an element of this vector.
+    constexpr void resize(std::size_t count, const T& value = T())
+    {
+        if (count < size())
+        {
+            std::destroy(storage.data + count, storage.data + size());
+            storage.size = count;
+            return;
+        }
+
+        const std::size_t added = count - size();
+        if (count > capacity())
+        {
+            reallocate_with(count, added, [added, &value](T* place) { construct_copies(place, added, value); });
+            return;
+        }
+
+        construct_copies(storage.data + size(), added, value);
+        storage.size = count;
+    }
+
+    // Copies exactly N elements into a std::array, which unlike the vector itself may outlive constant
+    // evaluation.
+    template <std::size_t N>
+    [[nodiscard]] constexpr std::array<T, N> to_array() const
+    {
+        if (N != size())
+        {
+            throw std::length_error("Array size does not match vector size");
+        }
+
+        return [this]<std::size_t... I>(std::index_sequence<I...>) {
+            return std::array<T, N>{storage.data[I]...};
+        }(std::make_index_sequence<N>{});
+    }
+
+    friend constexpr bool operator==(const ConstexprVector& lhs, const ConstexprVector& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+};
+
+// Bakes the ConstexprVector returned by Build into static storage, sizing the array from the result:
+//     constexpr auto table = vector::to_array<[] { ConstexprVector<int> v; ...; return v; }>();
+template <auto Build>
+constexpr auto to_array()
+{
+    constexpr std::size_t count = Build().size();
+    return Build().template to_array<count>();
+}
+
+}  // namespace vector
@@ -0,0 +1,341 @@
+#pragma once
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector/vector.hpp>
+
+// Elementwise arithmetic on Vectors of arithmetic types, enabled with `using namespace vector::arithmetic;`.
+// Operators build an expression tree instead of a Vector; assigning it to a Vector evaluates every element in a
+// single loop written straight into the destination:
+//
+//     a = b * c + d;
+//     a += 2.0 * b;
+//
+// Expressions refer to the Vectors they were built from, so they must be evaluated while those are alive and
+// unmodified; the destination may be one of them.
+
+#if defined(__clang__)
+#define VECTOR_IVDEP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define VECTOR_IVDEP _Pragma("GCC ivdep")
+#else
+#define VECTOR_IVDEP
+#endif
+
+namespace vector::arithmetic {
+
+template <typename T>
+concept Arithmetic = std::is_arithmetic_v<T>;
+
+struct ExpressionBase
+{
+};
+
+template <typename E>
+concept Expression = std::derived_from<E, ExpressionBase>;
+
+template <typename T>
+struct is_vector : std::false_type
+{
+};
+
+template <Arithmetic T>
+struct is_vector<Vector<T>> : std::true_type
+{
+};
+
+// Anything that can appear as an operand of the elementwise operators besides a scalar.
+template <typename X>
+concept Operand = Expression<X> || is_vector<X>::value;
+
+namespace detail {
+
+// Element i of the result depends only on element i of the operands, so the destination may alias an operand
+// and the loop carries no dependency.
+template <typename U, typename E>
+void evaluate(Vector<U>& dst, const E& source)
+{
+    const E expr = source;
+    const std::size_t count = expr.size();
+
+    dst.overwrite(count, [&expr, count](U* out) {
+        VECTOR_IVDEP
+        for (std::size_t i = 0; i < count; i++)
+        {
+            out[i] = static_cast<U>(expr[i]);
+        }
+    });
+}
+
+}  // namespace detail
+
+// Base of the nodes that a Vector can be assigned from.
+template <typename Derived>
+struct ExpressionNode : ExpressionBase
+{
+    template <Arithmetic U>
+    void evaluate_into(Vector<U>& dst) const
+    {
+        detail::evaluate(dst, static_cast<const Derived&>(*this));
+    }
+};
+
+template <Arithmetic T>
+class Leaf : public ExpressionBase
+{
+    const T* data;
+    std::size_t count;
+
+   public:
+    using value_type = T;
+    static constexpr bool sized = true;
+
+    explicit Leaf(const Vector<T>& vec) : data(vec.data()), count(vec.size())
+    {
+    }
+
+    T operator[](std::size_t i) const
+    {
+        return data[i];
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return count;
+    }
+};
+
+// A scalar operand, repeated to the size of the other side.
+template <Arithmetic T>
+class Scalar : public ExpressionBase
+{
+    T value;
+
+   public:
+    using value_type = T;
+    static constexpr bool sized = false;
+
+    explicit Scalar(T value) : value(value)
+    {
+    }
+
+    T operator[](std::size_t /*i*/) const
+    {
+        return value;
+    }
+};
+
+template <typename Op, Expression L, Expression R>
+class Binary : public ExpressionNode<Binary<Op, L, R>>
+{
+    L lhs;
+    R rhs;
+    std::size_t count;
+
+    static std::size_t common_size(const L& lhs, const R& rhs)
+    {
+        if constexpr (!L::sized)
+        {
+            return rhs.size();
+        }
+        else if constexpr (!R::sized)
+        {
+            return lhs.size();
+        }
+        else
+        {
+            if (lhs.size() != rhs.size())
+            {
+                throw std::invalid_argument("Vector sizes do not match");
+            }
+            return lhs.size();
+        }
+    }
+
+   public:
+    using value_type = std::invoke_result_t<Op, typename L::value_type, typename R::value_type>;
+    static constexpr bool sized = true;
+
+    Binary(L lhs, R rhs) : lhs(lhs), rhs(rhs), count(common_size(lhs, rhs))
+    {
+    }
+
+    value_type operator[](std::size_t i) const
+    {
+        return Op{}(lhs[i], rhs[i]);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return count;
+    }
+};
+
+template <typename Op, Expression E>
+class Unary : public ExpressionNode<Unary<Op, E>>
+{
+    E operand;
+
+   public:
+    using value_type = std::invoke_result_t<Op, typename E::value_type>;
+    static constexpr bool sized = true;
+
+    explicit Unary(E operand) : operand(operand)
+    {
+    }
+
+    value_type operator[](std::size_t i) const
+    {
+        return Op{}(operand[i]);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return operand.size();
+    }
+};
+
+template <Arithmetic T>
+Leaf<T> as_expression(const Vector<T>& vec)
+{
+    return Leaf<T>(vec);
+}
+
+template <Expression E>
+E as_expression(const E& expr)
+{
+    return expr;
+}
+
+template <Arithmetic T>
+Scalar<T> as_expression(T value)
+{
+    return Scalar<T>(value);
+}
+
+template <typename L, typename R>
+concept Operands = (Operand<L> && Operand<R>) || (Operand<L> && Arithmetic<R>) || (Arithmetic<L> && Operand<R>);
+
+template <typename Op, typename L, typename R>
+auto make_binary(const L& lhs, const R& rhs)
+{
+    using LE = decltype(as_expression(lhs));
+    using RE = decltype(as_expression(rhs));
+    return Binary<Op, LE, RE>(as_expression(lhs), as_expression(rhs));
+}
+
+template <typename L, typename R>
+    requires Operands<L, R>
+auto operator+(const L& lhs, const R& rhs)
+{
+    return make_binary<std::plus<>>(lhs, rhs);
+}
+
+template <typename L, typename R>
+    requires Operands<L, R>
+auto operator-(const L& lhs, const R& rhs)
+{
+    return make_binary<std::minus<>>(lhs, rhs);
+}
+
+template <typename L, typename R>
+    requires Operands<L, R>
+auto operator*(const L& lhs, const R& rhs)
+{
+    return make_binary<std::multiplies<>>(lhs, rhs);
+}
+
+template <typename L, typename R>
+    requires Operands<L, R>
+auto operator/(const L& lhs, const R& rhs)
+{
+    return make_binary<std::divides<>>(lhs, rhs);
+}
+
+template <Operand E>
+auto operator-(const E& operand)
+{
+    return Unary<std::negate<>, decltype(as_expression(operand))>(as_expression(operand));
+}
+
+template <Arithmetic T, typename R>
+    requires Operand<R> || Arithmetic<R>
+Vector<T>& operator+=(Vector<T>& dst, const R& rhs)
+{
+    return dst = make_binary<std::plus<>>(dst, rhs);
+}
+
+template <Arithmetic T, typename R>
+    requires Operand<R> || Arithmetic<R>
+Vector<T>& operator-=(Vector<T>& dst, const R& rhs)
+{
+    return dst = make_binary<std::minus<>>(dst, rhs);
+}
+
+template <Arithmetic T, typename R>
+    requires Operand<R> || Arithmetic<R>
+Vector<T>& operator*=(Vector<T>& dst, const R& rhs)
+{
+    return dst = make_binary<std::multiplies<>>(dst, rhs);
+}
+
+template <Arithmetic T, typename R>
+    requires Operand<R> || Arithmetic<R>
+Vector<T>& operator/=(Vector<T>& dst, const R& rhs)
+{
+    return dst = make_binary<std::divides<>>(dst, rhs);
+}
+
+// Sum of all elements. Accumulates into independent lanes that the compiler can keep in vector registers, so
+// floating-point results may differ from a left-to-right sum in the last bits.
+template <Operand E>
+auto sum(const E& operand)
+{
+    const auto expr = as_expression(operand);
+    using Element = typename decltype(expr)::value_type;
+    using V = decltype(std::declval<Element>() + std::declval<Element>());
+    constexpr std::size_t lanes = 8;
+
+    const std::size_t count = expr.size();
+    std::array<V, lanes> partial{};
+    std::size_t i = 0;
+
+    for (; i + lanes <= count; i += lanes)
+    {
+        for (std::size_t lane = 0; lane < lanes; lane++)
+        {
+            partial[lane] += expr[i + lane];
+        }
+    }
+
+    V total{};
+    for (; i < count; i++)
+    {
+        total += expr[i];
+    }
+    for (const V value : partial)
+    {
+        total += value;
+    }
+    return total;
+}
+
+template <Operand L, Operand R>
+auto dot(const L& lhs, const R& rhs)
+{
+    return sum(make_binary<std::multiplies<>>(lhs, rhs));
+}
+
+// Euclidean norm.
+template <Operand E>
+auto norm(const E& operand)
+{
+    return std::sqrt(dot(operand, operand));
+}
+
+}  // namespace vector::arithmetic
@@ -0,0 +1,259 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector/vector.hpp>
+#include <vector/search.hpp>
+
+namespace vector {
+
+// Sorted map with keys and mapped values kept in two parallel Vectors, so that searches only touch the
+// densely packed keys. Lookups use a branchless binary search, or an Eytzinger index once build_index()
+// has been called; any insertion or erasure drops the index.
+template <typename K, typename V, typename Compare = std::less<K>>
+class FlatMap
+{
+    Vector<K> map_keys;
+    Vector<V> map_values;
+    std::optional<EytzingerIndex<K, Compare>> index;
+    Compare comp;
+
+    [[nodiscard]] std::size_t lower_bound_index(const K& key) const
+    {
+        if (index)
+        {
+            return index->lower_bound(key);
+        }
+        return branchless_lower_bound(map_keys.data(), map_keys.size(), key, comp);
+    }
+
+    [[nodiscard]] bool found(std::size_t pos, const K& key) const
+    {
+        return (pos < map_keys.size()) && !comp(key, map_keys.data()[pos]);
+    }
+
+    template <typename KeyArg, typename... Args>
+    std::pair<std::size_t, bool> try_emplace_index(KeyArg&& key_arg, Args&&... args)
+    {
+        K key(std::forward<KeyArg>(key_arg));
+        const std::size_t pos = lower_bound_index(key);
+
+        if (found(pos, key))
+        {
+            return {pos, false};
+        }
+
+        V value(std::forward<Args>(args)...);
+
+        index.reset();
+        map_keys.insert(map_keys.cbegin() + pos, std::move(key));
+        try
+        {
+            map_values.insert(map_values.cbegin() + pos, std::move(value));
+        }
+        catch (...)
+        {
+            // Keys and values must stay parallel; the keys are unshared now, so this erase does not allocate.
+            map_keys.erase(map_keys.cbegin() + pos);
+            throw;
+        }
+        return {pos, true};
+    }
+
+   public:
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = std::size_t;
+    using key_compare = Compare;
+
+    explicit FlatMap(Compare comp = Compare{}) : comp(comp)
+    {
+    }
+
+    FlatMap(std::initializer_list<std::pair<K, V>> values, Compare comp = Compare{}) : comp(comp)
+    {
+        for (const auto& [key, value] : values)
+        {
+            insert_or_assign(key, value);
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return map_keys.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return map_keys.empty();
+    }
+
+    void reserve(std::size_t new_capacity)
+    {
+        map_keys.reserve(new_capacity);
+        map_values.reserve(new_capacity);
+    }
+
+    void clear()
+    {
+        index.reset();
+        map_keys.clear();
+        map_values.clear();
+    }
+
+    [[nodiscard]] const Vector<K>& keys() const noexcept
+    {
+        return map_keys;
+    }
+
+    [[nodiscard]] const Vector<V>& values() const noexcept
+    {
+        return map_values;
+    }
+
+    [[nodiscard]] bool contains(const K& key) const
+    {
+        return found(lower_bound_index(key), key);
+    }
+
+    [[nodiscard]] std::size_t count(const K& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    [[nodiscard]] const V* find(const K& key) const
+    {
+        const std::size_t pos = lower_bound_index(key);
+        return found(pos, key) ? map_values.data() + pos : nullptr;
+    }
+
+    [[nodiscard]] V* find(const K& key)
+    {
+        const std::size_t pos = lower_bound_index(key);
+        return found(pos, key) ? map_values.data() + pos : nullptr;
+    }
+
+    const V& at(const K& key) const
+    {
+        const V* value = find(key);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("Key not found");
+        }
+        return *value;
+    }
+
+    V& at(const K& key)
+    {
+        V* value = find(key);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("Key not found");
+        }
+        return *value;
+    }
+
+    V& operator[](const K& key)
+    {
+        return map_values[try_emplace_index(key).first];
+    }
+
+    template <typename KeyArg, typename... Args>
+    bool try_emplace(KeyArg&& key, Args&&... args)
+    {
+        return try_emplace_index(std::forward<KeyArg>(key), std::forward<Args>(args)...).second;
+    }
+
+    bool insert(const K& key, const V& value)
+    {
+        return try_emplace_index(key, value).second;
+    }
+
+    template <typename Arg>
+    bool insert_or_assign(const K& key, Arg&& value)
+    {
+        const auto [pos, inserted] = try_emplace_index(key, std::forward<Arg>(value));
+        if (!inserted)
+        {
+            map_values[pos] = std::forward<Arg>(value);
+        }
+        return inserted;
+    }
+
+    // Merges a range of key/value pairs sorted by key in one pass. Existing keys keep their values.
+    template <typename ForwardIt>
+    void insert_sorted_range(ForwardIt first, ForwardIt last)
+    {
+        const auto capacity = map_keys.size() + static_cast<std::size_t>(std::distance(first, last));
+        Vector<K> merged_keys(capacity);
+        Vector<V> merged_values(capacity);
+
+        const K* current_key = std::as_const(map_keys).data();
+        const V* current_value = std::as_const(map_values).data();
+        const K* keys_end = current_key + map_keys.size();
+
+        const auto emit = [&merged_keys, &merged_values, this](const K& key, const V& value) {
+            if (merged_keys.empty() || comp(std::as_const(merged_keys)[merged_keys.size() - 1], key))
+            {
+                merged_keys.push_back(key);
+                merged_values.push_back(value);
+            }
+        };
+
+        while ((current_key != keys_end) && (first != last))
+        {
+            if (comp(first->first, *current_key))
+            {
+                emit(first->first, first->second);
+                ++first;
+            }
+            else
+            {
+                emit(*current_key++, *current_value++);
+            }
+        }
+        for (; current_key != keys_end; ++current_key, ++current_value)
+        {
+            emit(*current_key, *current_value);
+        }
+        for (; first != last; ++first)
+        {
+            emit(first->first, first->second);
+        }
+
+        index.reset();
+        map_keys.swap(merged_keys);
+        map_values.swap(merged_values);
+    }
+
+    std::size_t erase(const K& key)
+    {
+        const std::size_t pos = lower_bound_index(key);
+
+        if (!found(pos, key))
+        {
+            return 0;
+        }
+
+        index.reset();
+        map_keys.erase(map_keys.cbegin() + pos);
+        map_values.erase(map_values.cbegin() + pos);
+        return 1;
+    }
+
+    void build_index()
+    {
+        index.emplace(std::as_const(map_keys).data(), map_keys.size(), comp);
+    }
+
+    [[nodiscard]] bool has_index() const noexcept
+    {
+        return index.has_value();
+    }
+};
+
+}  // namespace vector
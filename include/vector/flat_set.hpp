@@ -0,0 +1,195 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector/vector.hpp>
+#include <vector/search.hpp>
+
+namespace vector {
+
+// Sorted set stored contiguously in a Vector. Lookups use a branchless binary search, or an Eytzinger
+// index once build_index() has been called; any mutation drops the index.
+template <typename K, typename Compare = std::less<K>>
+class FlatSet
+{
+    Vector<K> keys;
+    std::optional<EytzingerIndex<K, Compare>> index;
+    Compare comp;
+
+    [[nodiscard]] std::size_t lower_bound_index(const K& key) const
+    {
+        if (index)
+        {
+            return index->lower_bound(key);
+        }
+        return branchless_lower_bound(keys.data(), keys.size(), key, comp);
+    }
+
+    [[nodiscard]] bool found(std::size_t pos, const K& key) const
+    {
+        return (pos < keys.size()) && !comp(key, keys.data()[pos]);
+    }
+
+   public:
+    using key_type = K;
+    using value_type = K;
+    using size_type = std::size_t;
+    using key_compare = Compare;
+    using const_iterator = const K*;
+    using iterator = const_iterator;
+
+    explicit FlatSet(Compare comp = Compare{}) : comp(comp)
+    {
+    }
+
+    FlatSet(std::initializer_list<K> values, Compare comp = Compare{}) : comp(comp)
+    {
+        for (const K& value : values)
+        {
+            insert(value);
+        }
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+        return keys.data();
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+        return keys.data() + keys.size();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return keys.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return keys.empty();
+    }
+
+    void reserve(std::size_t new_capacity)
+    {
+        keys.reserve(new_capacity);
+    }
+
+    void clear()
+    {
+        index.reset();
+        keys.clear();
+    }
+
+    [[nodiscard]] const Vector<K>& values() const noexcept
+    {
+        return keys;
+    }
+
+    [[nodiscard]] const_iterator lower_bound(const K& key) const
+    {
+        return begin() + lower_bound_index(key);
+    }
+
+    [[nodiscard]] const_iterator find(const K& key) const
+    {
+        const std::size_t pos = lower_bound_index(key);
+        return found(pos, key) ? begin() + pos : end();
+    }
+
+    [[nodiscard]] bool contains(const K& key) const
+    {
+        return found(lower_bound_index(key), key);
+    }
+
+    [[nodiscard]] std::size_t count(const K& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    template <typename Arg>
+    std::pair<const_iterator, bool> insert(Arg&& key)
+    {
+        K value(std::forward<Arg>(key));
+        const std::size_t pos = lower_bound_index(value);
+
+        if (found(pos, value))
+        {
+            return {begin() + pos, false};
+        }
+
+        index.reset();
+        keys.insert(keys.cbegin() + pos, std::move(value));
+        return {begin() + pos, true};
+    }
+
+    // Merges an ascending range into the set in one pass; keys already present are skipped.
+    template <typename ForwardIt>
+    void insert_sorted_range(ForwardIt first, ForwardIt last)
+    {
+        Vector<K> merged(keys.size() + static_cast<std::size_t>(std::distance(first, last)));
+        const K* current = std::as_const(keys).data();
+        const K* current_end = current + keys.size();
+
+        const auto emit = [&merged, this](const K& key) {
+            if (merged.empty() || comp(std::as_const(merged)[merged.size() - 1], key))
+            {
+                merged.push_back(key);
+            }
+        };
+
+        while ((current != current_end) && (first != last))
+        {
+            if (comp(*first, *current))
+            {
+                emit(*first);
+                ++first;
+            }
+            else
+            {
+                emit(*current);
+                ++current;
+            }
+        }
+        for (; current != current_end; ++current)
+        {
+            emit(*current);
+        }
+        for (; first != last; ++first)
+        {
+            emit(*first);
+        }
+
+        index.reset();
+        keys.swap(merged);
+    }
+
+    std::size_t erase(const K& key)
+    {
+        const std::size_t pos = lower_bound_index(key);
+
+        if (!found(pos, key))
+        {
+            return 0;
+        }
+
+        index.reset();
+        keys.erase(keys.cbegin() + pos);
+        return 1;
+    }
+
+    void build_index()
+    {
+        index.emplace(std::as_const(keys).data(), keys.size(), comp);
+    }
+
+    [[nodiscard]] bool has_index() const noexcept
+    {
+        return index.has_value();
+    }
+};
+
+}  // namespace vector
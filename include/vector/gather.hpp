@@ -0,0 +1,326 @@
+#pragma once
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector/sort.hpp>
+#include <vector/vector.hpp>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+// Indirect access through an index Vector: out[i] = source[indices[i]] (gather), dest[indices[i]] = values[i]
+// (scatter) and visiting source[indices[i]] (for_each_indexed). Random indices into a large source are bound by
+// memory latency, so every helper prefetches the element `prefetch_distance` indices ahead. Optionally each batch
+// of indices is visited in increasing order, so that nearby indices share cache lines and pages. When the build
+// targets AVX2 or AVX-512, gathers of 4- and 8-byte elements through 32-bit indices use the hardware gather
+// instructions.
+
+namespace vector {
+
+struct GatherOptions
+{
+    // How many indices ahead to prefetch; 0 disables prefetching.
+    std::size_t prefetch_distance = 16;
+    // Visits the indices of each batch of sort_batch in increasing order. Gathered values still land at their own
+    // positions; scattering to a repeated index keeps the last write.
+    bool sort_indices = false;
+    std::size_t sort_batch = std::size_t{1} << 16;
+};
+
+namespace detail {
+
+inline void prefetch(const void* address) noexcept
+{
+#if defined(__GNUC__)
+    __builtin_prefetch(address);
+#else
+    static_cast<void>(address);
+#endif
+}
+
+inline void prefetch_for_write(const void* address) noexcept
+{
+#if defined(__GNUC__)
+    __builtin_prefetch(address, 1);
+#else
+    static_cast<void>(address);
+#endif
+}
+
+template <std::unsigned_integral I>
+void check_indices(const I* indices, std::size_t count, std::size_t bound)
+{
+    I largest = 0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        largest = std::max(largest, indices[i]);
+    }
+    if ((count > 0) && !(static_cast<std::size_t>(largest) < bound))
+    {
+        throw std::out_of_range("Index out of range");
+    }
+}
+
+// Calls body(i) for i in [first, count), calling ahead(i + distance) alongside while that is below count. The
+// prefetching part and the tail are separate loops so the bounds check stays out of the hot one.
+template <typename Ahead, typename Body>
+void prefetched_loop(std::size_t first, std::size_t count, std::size_t distance, Ahead ahead, Body body)
+{
+    std::size_t i = first;
+    if (distance > 0)
+    {
+        for (; i + distance < count; i++)
+        {
+            ahead(i + distance);
+            body(i);
+        }
+    }
+    for (; i < count; i++)
+    {
+        body(i);
+    }
+}
+
+// Hardware gather of out[i] = source[indices[i]] for i in [0, count); returns how many it handled, always a
+// prefix. The instructions take signed 32-bit indices, so larger sources fall back to scalar loads.
+template <typename T, typename I>
+std::size_t gather_instructions(
+    const T* source,
+    std::size_t source_size,
+    const I* indices,
+    T* out,
+    std::size_t count,
+    std::size_t distance) noexcept
+{
+    if constexpr (!std::is_same_v<I, std::uint32_t> || !std::is_trivially_copyable_v<T>)
+    {
+        return 0;
+    }
+    else
+    {
+        if (source_size > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+        {
+            return 0;
+        }
+
+        std::size_t i = 0;
+        [[maybe_unused]] const auto prefetch_ahead = [&](std::size_t first, std::size_t lanes) {
+            if ((distance > 0) && (first + distance + lanes <= count))
+            {
+                for (std::size_t lane = 0; lane < lanes; lane++)
+                {
+                    prefetch(source + indices[first + distance + lane]);
+                }
+            }
+        };
+
+#if defined(__AVX512F__)
+        // The masked forms with a zero source avoid GCC's uninitialized-vector warning on the unmasked ones.
+        if constexpr (sizeof(T) == 4)
+        {
+            for (; i + 16 <= count; i += 16)
+            {
+                prefetch_ahead(i, 16);
+                const __m512i index = _mm512_loadu_si512(indices + i);
+                const __m512i values = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xFFFF, index, source, 4);
+                _mm512_storeu_si512(out + i, values);
+            }
+        }
+        else if constexpr (sizeof(T) == 8)
+        {
+            for (; i + 8 <= count; i += 8)
+            {
+                prefetch_ahead(i, 8);
+                const __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+                const __m512i values = _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), 0xFF, index, source, 8);
+                _mm512_storeu_si512(out + i, values);
+            }
+        }
+#elif defined(__AVX2__)
+        if constexpr (sizeof(T) == 4)
+        {
+            for (; i + 8 <= count; i += 8)
+            {
+                prefetch_ahead(i, 8);
+                const __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+                const __m256i values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(source), index, 4);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), values);
+            }
+        }
+        else if constexpr (sizeof(T) == 8)
+        {
+            for (; i + 4 <= count; i += 4)
+            {
+                prefetch_ahead(i, 4);
+                const __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+                const __m256i values = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(source), index, 8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), values);
+            }
+        }
+#else
+        static_cast<void>(source);
+        static_cast<void>(indices);
+        static_cast<void>(out);
+        static_cast<void>(count);
+        static_cast<void>(distance);
+#endif
+        return i;
+    }
+}
+
+// Calls visit(position) for every position in [0, count), in batches ordered by indices[position] when sorting is
+// requested.
+template <std::unsigned_integral I, typename Visit>
+void visit_sorted(const I* indices, std::size_t count, const GatherOptions& options, Visit visit)
+{
+    const std::size_t batch = std::clamp<std::size_t>(options.sort_batch, 1, std::numeric_limits<std::uint32_t>::max());
+    Vector<I> keys(std::min(count, batch));
+    Vector<std::uint32_t> positions(std::min(count, batch));
+
+    for (std::size_t first = 0; first < count; first += batch)
+    {
+        const std::size_t size = std::min(batch, count - first);
+        keys.overwrite(size, [&](I* out) { std::copy_n(indices + first, size, out); });
+        positions.overwrite(size, [&](std::uint32_t* out) {
+            for (std::size_t i = 0; i < size; i++)
+            {
+                out[i] = static_cast<std::uint32_t>(i);
+            }
+        });
+        sort_by_key(keys, positions);
+
+        const std::uint32_t* order = std::as_const(positions).data();
+        for (std::size_t i = 0; i < size; i++)
+        {
+            visit(first + order[i]);
+        }
+    }
+}
+
+}  // namespace detail
+
+// out = source[indices[0]], source[indices[1]], ...; throws std::out_of_range if any index is not below
+// source.size(). `out` may be `source` or `indices`.
+template <typename T, std::unsigned_integral I>
+void gather(const Vector<T>& source, const Vector<I>& indices, Vector<T>& out, const GatherOptions& options = {})
+{
+    if ((static_cast<const void*>(&out) == &source) || (static_cast<const void*>(&out) == &indices))
+    {
+        Vector<T> result;
+        gather(source, indices, result, options);
+        out.swap(result);
+        return;
+    }
+
+    const T* src = source.data();
+    const I* idx = indices.data();
+    const std::size_t count = indices.size();
+    const std::size_t distance = options.prefetch_distance;
+    detail::check_indices(idx, count, source.size());
+
+    if constexpr (std::is_trivial_v<T>)
+    {
+        out.overwrite(count, [&](T* dst) {
+            if (options.sort_indices)
+            {
+                detail::visit_sorted(idx, count, options, [&](std::size_t i) { dst[i] = src[idx[i]]; });
+                return;
+            }
+
+            detail::prefetched_loop(
+                detail::gather_instructions(src, source.size(), idx, dst, count, distance),
+                count,
+                distance,
+                [&](std::size_t j) { detail::prefetch(src + idx[j]); },
+                [&](std::size_t i) { dst[i] = src[idx[i]]; });
+        });
+    }
+    else
+    {
+        Vector<T> result(std::max<std::size_t>(count, 1));
+        detail::prefetched_loop(
+            0,
+            count,
+            distance,
+            [&](std::size_t j) { detail::prefetch(src + idx[j]); },
+            [&](std::size_t i) { result.push_back(src[idx[i]]); });
+        out.swap(result);
+    }
+}
+
+template <typename T, std::unsigned_integral I>
+Vector<T> gather(const Vector<T>& source, const Vector<I>& indices, const GatherOptions& options = {})
+{
+    Vector<T> out;
+    gather(source, indices, out, options);
+    return out;
+}
+
+// dest[indices[i]] = values[i] in order, so the last of repeated indices wins. Throws std::invalid_argument if the
+// sizes differ and std::out_of_range if any index is not below dest.size(), before writing anything.
+template <typename T, std::unsigned_integral I>
+void scatter(Vector<T>& dest, const Vector<I>& indices, const Vector<T>& values, const GatherOptions& options = {})
+{
+    if (indices.size() != values.size())
+    {
+        throw std::invalid_argument("Vector sizes do not match");
+    }
+
+    const std::size_t count = indices.size();
+    const std::size_t distance = options.prefetch_distance;
+    detail::check_indices(indices.data(), count, dest.size());
+
+    if (count == 0)
+    {
+        return;
+    }
+    // Unsharing dest may give it a new buffer, so the inputs are read afterwards in case they are dest itself.
+    T* dst = dest.data();
+    const I* idx = indices.data();
+    const T* src = values.data();
+
+    if (options.sort_indices)
+    {
+        detail::visit_sorted(idx, count, options, [&](std::size_t i) { dst[idx[i]] = src[i]; });
+        return;
+    }
+
+    detail::prefetched_loop(
+        0,
+        count,
+        distance,
+        [&](std::size_t j) { detail::prefetch_for_write(dst + idx[j]); },
+        [&](std::size_t i) { dst[idx[i]] = src[i]; });
+}
+
+// Calls f(i, source[indices[i]]) for every i; with sort_indices the calls within a batch come in index order
+// rather than in order of i.
+template <typename T, std::unsigned_integral I, typename F>
+void for_each_indexed(const Vector<T>& source, const Vector<I>& indices, F f, const GatherOptions& options = {})
+{
+    const T* src = source.data();
+    const I* idx = indices.data();
+    const std::size_t count = indices.size();
+    const std::size_t distance = options.prefetch_distance;
+    detail::check_indices(idx, count, source.size());
+
+    if (options.sort_indices)
+    {
+        detail::visit_sorted(idx, count, options, [&](std::size_t i) { f(i, src[idx[i]]); });
+        return;
+    }
+
+    detail::prefetched_loop(
+        0,
+        count,
+        distance,
+        [&](std::size_t j) { detail::prefetch(src + idx[j]); },
+        [&](std::size_t i) { f(i, src[idx[i]]); });
+}
+
+}  // namespace vector
@@ -0,0 +1,80 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+// VECTOR_HARDENING_LEVEL selects the debug checks compiled into the containers:
+//   0 - none (default when NDEBUG is defined)
+//   1 - precondition checks: operator[] bounds, pop_back on empty, insert/erase positions
+//   2 - level 1 plus iterator invalidation tracking and, under AddressSanitizer, poisoning of the
+//       unused capacity so that reads past size() are reported (default otherwise)
+// Every translation unit of a program must use the same level.
+#ifndef VECTOR_HARDENING_LEVEL
+#ifdef NDEBUG
+#define VECTOR_HARDENING_LEVEL 0
+#else
+#define VECTOR_HARDENING_LEVEL 2
+#endif
+#endif
+
+#if defined(__SANITIZE_ADDRESS__)
+#define VECTOR_HAS_ASAN 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define VECTOR_HAS_ASAN 1
+#endif
+#endif
+
+#if (VECTOR_HARDENING_LEVEL >= 2) && defined(VECTOR_HAS_ASAN)
+#define VECTOR_ANNOTATE_CONTAINER 1
+#include <sanitizer/common_interface_defs.h>
+#else
+#define VECTOR_ANNOTATE_CONTAINER 0
+#endif
+
+namespace vector::hardening {
+
+[[noreturn]] inline void fail(const char* message, const char* file, int line) noexcept
+{
+    std::fprintf(stderr, "%s:%d: vector hardening check failed: %s\n", file, line, message);
+    std::abort();
+}
+
+// Marks [begin, new_mid) as addressable and [new_mid, end) as poisoned. Only whole 8-byte shadow granules are
+// annotated: arena and pool buffers may share their last granule with a neighbouring allocation, and buffers
+// that do not start on a granule (possible for arena-backed storage of small types) are left alone.
+inline void annotate(const void* begin, const void* end, const void* old_mid, const void* new_mid) noexcept
+{
+#if VECTOR_ANNOTATE_CONTAINER
+    constexpr std::uintptr_t granularity = 8;
+    const auto first = reinterpret_cast<std::uintptr_t>(begin);
+    const std::uintptr_t last = first + ((reinterpret_cast<std::uintptr_t>(end) - first) & ~(granularity - 1));
+
+    if ((begin == nullptr) || (first % granularity != 0) || (first == last))
+    {
+        return;
+    }
+
+    const auto clamp = [last](const void* mid) {
+        return reinterpret_cast<const void*>(std::min(reinterpret_cast<std::uintptr_t>(mid), last));
+    };
+    __sanitizer_annotate_contiguous_container(
+        begin, reinterpret_cast<const void*>(last), clamp(old_mid), clamp(new_mid));
+#else
+    static_cast<void>(begin);
+    static_cast<void>(end);
+    static_cast<void>(old_mid);
+    static_cast<void>(new_mid);
+#endif
+}
+
+}  // namespace vector::hardening
+
+#if VECTOR_HARDENING_LEVEL >= 1
+#define VECTOR_HARDENING_ASSERT(condition, message) \
+    ((condition) ? static_cast<void>(0) : ::vector::hardening::fail(message, __FILE__, __LINE__))
+#else
+#define VECTOR_HARDENING_ASSERT(condition, message) static_cast<void>(0)
+#endif
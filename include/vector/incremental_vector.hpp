@@ -0,0 +1,318 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector/index_iterator.hpp>
+#include <vector/vector.hpp>
+
+namespace vector {
+
+// Vector whose growth is spread over the following pushes instead of being paid inside one push_back. When the
+// buffer fills, a larger one is allocated and the elements stay in the old buffer. Each later emplace_back moves
+// the next migration_step of them, so no single call copies more than a constant number of elements. Element
+// i lives at index i of the new buffer once migrated, or at index i of the old one before that. Both buffers keep
+// their size field at zero; this class manages element lifetimes itself.
+template <typename T>
+class IncrementalVector
+{
+   public:
+    // With growth by vector::factor, the new buffer has room for at least as many pushes as there are elements to
+    // migrate, so one element per push finishes in time; the second gives slack after pop_back.
+    static constexpr std::size_t migration_step = 2;
+
+   private:
+    VecStorage<T> current;
+    VecStorage<T> old;
+    std::size_t count = 0;
+    // Elements [migrated, old_count) are still in the old buffer.
+    std::size_t migrated = 0;
+    std::size_t old_count = 0;
+
+    [[nodiscard]] T* slot(std::size_t pos) const noexcept
+    {
+        if ((pos >= migrated) && (pos < old_count))
+        {
+            return old.data + pos;
+        }
+        return current.data + pos;
+    }
+
+    void migrate(std::size_t steps)
+    {
+        const std::size_t stop = std::min(old_count, migrated + steps);
+        for (; migrated < stop; migrated++)
+        {
+            new (current.data + migrated) T(std::move_if_noexcept(old.data[migrated]));
+            std::destroy_at(old.data + migrated);
+        }
+        release_old_if_done();
+    }
+
+    void release_old_if_done() noexcept
+    {
+        if ((migrated >= old_count) && (old.data != nullptr))
+        {
+            VecStorage<T> released(std::move(old));
+            migrated = 0;
+            old_count = 0;
+        }
+    }
+
+    // Swaps in `grown` without moving anything; `grown` is left empty. A migration still running, which only a
+    // reserve() just below the next growth can cause, is finished first.
+    void start_migration(VecStorage<T>& grown)
+    {
+        finish_migration();
+
+        old.swap(current);
+        current.swap(grown);
+        migrated = 0;
+        old_count = count;
+        release_old_if_done();
+    }
+
+    // Completes a push whose element was built at `place`: migrates the next step and counts the element.
+    T& finish_push(T* place)
+    {
+        try
+        {
+            migrate(migration_step);
+        }
+        catch (...)
+        {
+            std::destroy_at(place);
+            throw;
+        }
+
+        ++count;
+        return *place;
+    }
+
+    void destroy_all() noexcept
+    {
+        for (std::size_t pos = 0; pos < count; pos++)
+        {
+            std::destroy_at(slot(pos));
+        }
+    }
+
+   public:
+    using value_type = T;
+    using iterator = IndexIterator<IncrementalVector, false>;
+    using const_iterator = IndexIterator<IncrementalVector, true>;
+
+    IncrementalVector() = default;
+
+    explicit IncrementalVector(std::size_t capacity) : current(std::max<std::size_t>(capacity, 1))
+    {
+    }
+
+    IncrementalVector(const IncrementalVector& other) : IncrementalVector(other.size())
+    {
+        for (std::size_t pos = 0; pos < other.count; pos++)
+        {
+            push_back(other[pos]);
+        }
+    }
+
+    IncrementalVector(IncrementalVector&& other) noexcept
+        : current(std::move(other.current)),
+          old(std::move(other.old)),
+          count(std::exchange(other.count, 0)),
+          migrated(std::exchange(other.migrated, 0)),
+          old_count(std::exchange(other.old_count, 0))
+    {
+    }
+
+    IncrementalVector& operator=(IncrementalVector other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~IncrementalVector()
+    {
+        destroy_all();
+    }
+
+    void swap(IncrementalVector& other) noexcept
+    {
+        current.swap(other.current);
+        old.swap(other.old);
+        std::swap(count, other.count);
+        std::swap(migrated, other.migrated);
+        std::swap(old_count, other.old_count);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return count;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return current.capacity;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return count == 0;
+    }
+
+    [[nodiscard]] bool migrating() const noexcept
+    {
+        return migrated < old_count;
+    }
+
+    // Moves every element still in the old buffer and frees it.
+    void finish_migration()
+    {
+        migrate(old_count - migrated);
+    }
+
+    // Swaps in a larger buffer like a growing push_back does; the elements follow over the next pushes.
+    void reserve(std::size_t new_capacity)
+    {
+        if (new_capacity > capacity())
+        {
+            VecStorage<T> grown(new_capacity);
+            start_migration(grown);
+        }
+    }
+
+    void clear() noexcept
+    {
+        destroy_all();
+        count = 0;
+        migrated = old_count;
+        release_old_if_done();
+    }
+
+    // The elements as one contiguous run, finishing any migration first.
+    [[nodiscard]] std::span<T> contiguous()
+    {
+        finish_migration();
+        return std::span<T>(current.data, count);
+    }
+
+    const T& operator[](std::size_t pos) const
+    {
+        return *slot(pos);
+    }
+
+    T& operator[](std::size_t pos)
+    {
+        return *slot(pos);
+    }
+
+    const T& at(std::size_t pos) const
+    {
+        if (!(pos < size()))
+        {
+            throw std::out_of_range("Pos out of range");
+        }
+        return *slot(pos);
+    }
+
+    T& at(std::size_t pos)
+    {
+        if (!(pos < size()))
+        {
+            throw std::out_of_range("Pos out of range");
+        }
+        return *slot(pos);
+    }
+
+    T& front()
+    {
+        return *slot(0);
+    }
+
+    const T& front() const
+    {
+        return *slot(0);
+    }
+
+    T& back()
+    {
+        return *slot(count - 1);
+    }
+
+    const T& back() const
+    {
+        return *slot(count - 1);
+    }
+
+    // The new element is constructed before anything is moved or freed, in the new buffer when the vector is full,
+    // so arguments that refer to elements of this vector stay valid. If migrating throws, the new element is
+    // destroyed again and the push has no effect.
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (count == capacity())
+        {
+            VecStorage<T> grown(std::max<std::size_t>(capacity() * vector::factor, 1));
+            T* place = new (grown.data + count) T(std::forward<Args>(args)...);
+            try
+            {
+                start_migration(grown);
+            }
+            catch (...)
+            {
+                std::destroy_at(place);
+                throw;
+            }
+            return finish_push(place);
+        }
+
+        return finish_push(new (current.data + count) T(std::forward<Args>(args)...));
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    void pop_back()
+    {
+        --count;
+        std::destroy_at(slot(count));
+        old_count = std::min(old_count, count);
+        release_old_if_done();
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+    iterator end() noexcept
+    {
+        return iterator(this, count);
+    }
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, count);
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+};
+
+}  // namespace vector
@@ -0,0 +1,117 @@
+#pragma once
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace vector {
+
+// Random-access iterator that holds a container and a position and dereferences through the container's
+// operator[], for containers whose elements are not one contiguous run. The reference type is whatever operator[]
+// returns, which may be a value computed on the fly.
+template <typename Container, bool Const>
+class IndexIterator
+{
+    using Owner = std::conditional_t<Const, const Container, Container>;
+    using Element = typename Container::value_type;
+
+    Owner* owner = nullptr;
+    std::size_t index = 0;
+
+    friend Container;
+    friend class IndexIterator<Container, !Const>;
+
+    IndexIterator(Owner* owner, std::size_t index) : owner(owner), index(index)
+    {
+    }
+
+   public:
+    using value_type = Element;
+    using reference = decltype(std::declval<Owner&>()[std::size_t{}]);
+    using pointer = std::conditional_t<Const, const Element*, Element*>;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    IndexIterator() = default;
+
+    operator IndexIterator<Container, true>() const noexcept
+    {
+        return IndexIterator<Container, true>(owner, index);
+    }
+
+    reference operator*() const
+    {
+        return (*owner)[index];
+    }
+    pointer operator->() const
+    {
+        return &(*owner)[index];
+    }
+    reference operator[](difference_type offset) const
+    {
+        return (*owner)[index + offset];
+    }
+
+    IndexIterator& operator++()
+    {
+        ++index;
+        return *this;
+    }
+    IndexIterator operator++(int)
+    {
+        IndexIterator it(*this);
+        ++index;
+        return it;
+    }
+    IndexIterator& operator--()
+    {
+        --index;
+        return *this;
+    }
+    IndexIterator operator--(int)
+    {
+        IndexIterator it(*this);
+        --index;
+        return it;
+    }
+    IndexIterator& operator+=(difference_type offset)
+    {
+        index += offset;
+        return *this;
+    }
+    IndexIterator& operator-=(difference_type offset)
+    {
+        index -= offset;
+        return *this;
+    }
+    IndexIterator operator+(difference_type offset) const
+    {
+        IndexIterator it(*this);
+        return it += offset;
+    }
+    friend IndexIterator operator+(difference_type offset, IndexIterator it)
+    {
+        return it + offset;
+    }
+    IndexIterator operator-(difference_type offset) const
+    {
+        IndexIterator it(*this);
+        return it -= offset;
+    }
+    difference_type operator-(const IndexIterator& other) const
+    {
+        return static_cast<difference_type>(index - other.index);
+    }
+
+    bool operator==(const IndexIterator& rhs) const
+    {
+        return index == rhs.index;
+    }
+    auto operator<=>(const IndexIterator& rhs) const
+    {
+        return index <=> rhs.index;
+    }
+};
+
+}  // namespace vector
@@ -0,0 +1,455 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <vector/vector.hpp>
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// NUMA placement for Vector buffers on Linux, through the mbind, set_mempolicy and get_mempolicy system calls
+// so that libnuma is not needed. Placement is only a hint: on a single node, on other platforms, or when the kernel
+// refuses a call, every function leaves memory where it is and reports that it did nothing.
+
+namespace vector::numa {
+
+enum class Placement
+{
+    // Pages spread round-robin over all nodes.
+    interleave,
+    // Pages on one node.
+    bind,
+};
+
+namespace detail {
+
+// Node masks are a single unsigned long.
+inline constexpr std::size_t max_nodes = 64;
+
+// Parses the kernel's list format, e.g. "0-3,8,10-11".
+inline std::vector<unsigned> parse_list(const char* text)
+{
+    std::vector<unsigned> values;
+    unsigned first = 0;
+    unsigned current = 0;
+    bool in_range = false;
+    bool has_digits = false;
+
+    for (const char* c = text;; c++)
+    {
+        if ((*c >= '0') && (*c <= '9'))
+        {
+            current = current * 10 + static_cast<unsigned>(*c - '0');
+            has_digits = true;
+        }
+        else if ((*c == '-') && has_digits)
+        {
+            first = current;
+            current = 0;
+            in_range = true;
+            has_digits = false;
+        }
+        else
+        {
+            if (has_digits)
+            {
+                for (unsigned value = in_range ? first : current; value <= current; value++)
+                {
+                    values.push_back(value);
+                }
+            }
+            if ((*c == '\0') || (*c == '\n'))
+            {
+                return values;
+            }
+            current = 0;
+            in_range = false;
+            has_digits = false;
+        }
+    }
+}
+
+inline std::vector<unsigned> read_list(const char* path)
+{
+    std::FILE* file = std::fopen(path, "r");
+    if (file == nullptr)
+    {
+        return {};
+    }
+
+    std::array<char, 4096> line{};
+    const bool read = std::fgets(line.data(), static_cast<int>(line.size()), file) != nullptr;
+    std::fclose(file);
+    return read ? parse_list(line.data()) : std::vector<unsigned>{};
+}
+
+struct Topology
+{
+    // Online node ids, and the CPUs of each, in the same order.
+    std::vector<unsigned> nodes{0};
+    std::vector<std::vector<unsigned>> cpus{{}};
+    // Position of each node id in `nodes`.
+    std::array<std::uint8_t, max_nodes> index{};
+};
+
+inline Topology read_topology()
+{
+    Topology topology;
+#if defined(__linux__)
+    std::vector<unsigned> nodes = read_list("/sys/devices/system/node/online");
+    std::erase_if(nodes, [](unsigned node) { return node >= max_nodes; });
+    if (nodes.size() < 2)
+    {
+        return topology;
+    }
+
+    topology.nodes = nodes;
+    topology.cpus.clear();
+    for (std::size_t i = 0; i < nodes.size(); i++)
+    {
+        std::array<char, 64> path{};
+        std::snprintf(path.data(), path.size(), "/sys/devices/system/node/node%u/cpulist", nodes[i]);
+        topology.cpus.push_back(read_list(path.data()));
+        topology.index[nodes[i]] = static_cast<std::uint8_t>(i);
+    }
+#endif
+    return topology;
+}
+
+inline const Topology& topology()
+{
+    static const Topology cached = read_topology();
+    return cached;
+}
+
+inline unsigned long node_mask(Placement placement, unsigned node)
+{
+    if (placement == Placement::bind)
+    {
+        if (node >= max_nodes)
+        {
+            throw std::invalid_argument("NUMA node out of range");
+        }
+        return 1UL << node;
+    }
+
+    unsigned long mask = 0;
+    for (const unsigned id : topology().nodes)
+    {
+        mask |= 1UL << id;
+    }
+    return mask;
+}
+
+#if defined(__linux__)
+inline int policy_mode(Placement placement)
+{
+    return placement == Placement::interleave ? MPOL_INTERLEAVE : MPOL_BIND;
+}
+#endif
+
+inline std::uintptr_t page_size()
+{
+#if defined(__linux__)
+    return static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 4096;
+#endif
+}
+
+// Pins the calling thread to the CPUs of the node at `index` in the topology.
+inline void pin_to_node(std::size_t index)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const unsigned cpu : topology().cpus[index])
+    {
+        if (cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &set);
+        }
+    }
+    static_cast<void>(sched_setaffinity(0, sizeof(set), &set));
+#else
+    static_cast<void>(index);
+#endif
+}
+
+}  // namespace detail
+
+[[nodiscard]] inline std::size_t node_count()
+{
+    return detail::topology().nodes.size();
+}
+
+// Position of the calling thread's node among the online nodes, in [0, node_count()).
+[[nodiscard]] inline std::size_t current_node()
+{
+#if defined(__linux__)
+    if (node_count() > 1)
+    {
+        unsigned cpu = 0;
+        unsigned node = 0;
+        if ((getcpu(&cpu, &node) == 0) && (node < detail::max_nodes))
+        {
+            return detail::topology().index[node];
+        }
+    }
+#endif
+    return 0;
+}
+
+// Node id of the page holding `address`, faulting it in if it was never touched; nullopt when unknown.
+[[nodiscard]] inline std::optional<unsigned> node_of(const void* address)
+{
+#if defined(__linux__)
+    if (node_count() > 1)
+    {
+        int node = -1;
+        if (syscall(SYS_get_mempolicy, &node, nullptr, 0UL, address, MPOL_F_NODE | MPOL_F_ADDR) == 0)
+        {
+            return static_cast<unsigned>(node);
+        }
+        return std::nullopt;
+    }
+    return detail::topology().nodes[0];
+#else
+    static_cast<void>(address);
+    return std::nullopt;
+#endif
+}
+
+// Applies the placement to every page overlapping [data, data + bytes) and migrates pages already touched.
+// `node` is a node id and only matters for Placement::bind. Returns whether the kernel applied it.
+inline bool place(const void* data, std::size_t bytes, Placement placement, unsigned node = 0)
+{
+#if defined(__linux__)
+    if ((node_count() < 2) || (bytes == 0))
+    {
+        return false;
+    }
+
+    const unsigned long mask = detail::node_mask(placement, node);
+    const std::uintptr_t page = detail::page_size();
+    const auto first = reinterpret_cast<std::uintptr_t>(data) & ~(page - 1);
+    const auto last = (reinterpret_cast<std::uintptr_t>(data) + bytes + page - 1) & ~(page - 1);
+
+    return syscall(
+               SYS_mbind,
+               first,
+               last - first,
+               detail::policy_mode(placement),
+               &mask,
+               detail::max_nodes,
+               MPOL_MF_MOVE)
+           == 0;
+#else
+    static_cast<void>(data);
+    static_cast<void>(bytes);
+    static_cast<void>(placement);
+    static_cast<void>(node);
+    return false;
+#endif
+}
+
+// Places the whole buffer of `vec`, including its spare capacity. Buffers shared with copies move for all of them.
+template <typename T>
+bool place(const Vector<T>& vec, Placement placement, unsigned node = 0)
+{
+    return place(vec.data(), vec.capacity() * sizeof(T), placement, node);
+}
+
+// Sets the calling thread's allocation policy for the pages it touches first while in scope, and restores the
+// previous policy on exit.
+class ScopedPolicy
+{
+#if defined(__linux__)
+    int previous_mode = MPOL_DEFAULT;
+    unsigned long previous_mask = 0;
+#endif
+    bool applied = false;
+
+   public:
+    explicit ScopedPolicy(Placement placement, unsigned node = 0)
+    {
+#if defined(__linux__)
+        if (node_count() < 2)
+        {
+            return;
+        }
+
+        if (syscall(SYS_get_mempolicy, &previous_mode, &previous_mask, detail::max_nodes, nullptr, 0UL) != 0)
+        {
+            return;
+        }
+
+        const unsigned long mask = detail::node_mask(placement, node);
+        applied = syscall(SYS_set_mempolicy, detail::policy_mode(placement), &mask, detail::max_nodes) == 0;
+#else
+        static_cast<void>(placement);
+        static_cast<void>(node);
+#endif
+    }
+
+    ScopedPolicy(const ScopedPolicy&) = delete;
+    ScopedPolicy& operator=(const ScopedPolicy&) = delete;
+
+    ~ScopedPolicy()
+    {
+#if defined(__linux__)
+        if (applied)
+        {
+            const unsigned long* mask = previous_mode == MPOL_DEFAULT ? nullptr : &previous_mask;
+            static_cast<void>(syscall(SYS_set_mempolicy, previous_mode, mask, detail::max_nodes));
+        }
+#endif
+    }
+
+    [[nodiscard]] bool active() const noexcept
+    {
+        return applied;
+    }
+};
+
+// Calls body(node) once per node, node being a position in [0, node_count()), from a thread pinned to that
+// node's CPUs. On a single node it simply calls body(0).
+template <typename Body>
+void run_on_nodes(Body body)
+{
+    const std::size_t nodes = node_count();
+    if (nodes < 2)
+    {
+        body(std::size_t{0});
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(nodes);
+    for (std::size_t node = 0; node < nodes; node++)
+    {
+        workers.emplace_back([&body, node] {
+            detail::pin_to_node(node);
+            body(node);
+        });
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+// Builds a Vector of `count` elements generate(i) where each node writes, and so first touches, its own
+// contiguous share of the buffer. Shares are split at page boundaries of the buffer, so every page is touched
+// by one node only, apart from elements that straddle a boundary. Pages of a recycled allocation that were
+// already touched stay where they are; place() moves them.
+template <typename T, typename Generate>
+    requires std::is_trivial_v<T>
+Vector<T> first_touch_parallel(std::size_t count, Generate generate)
+{
+    Vector<T> vec;
+    vec.overwrite(count, [count, &generate](T* out) {
+        const std::size_t nodes = node_count();
+        const std::size_t share = (count + nodes - 1) / nodes;
+        const std::uintptr_t page = detail::page_size();
+        const auto base = reinterpret_cast<std::uintptr_t>(out);
+
+        // First element of a node's share: the first one starting at or after the page boundary that follows
+        // its even split point.
+        const auto split = [&](std::size_t node) -> std::size_t {
+            if (node == 0)
+            {
+                return 0;
+            }
+            const std::uintptr_t at = base + (std::min(count, node * share) * sizeof(T));
+            const std::uintptr_t boundary = (at + page - 1) & ~(page - 1);
+            return std::min<std::size_t>(count, (boundary - base + sizeof(T) - 1) / sizeof(T));
+        };
+
+        run_on_nodes([&](std::size_t node) {
+            const std::size_t end = split(node + 1);
+            for (std::size_t i = split(node); i < end; i++)
+            {
+                out[i] = generate(i);
+            }
+        });
+    });
+    return vec;
+}
+
+// Read-only copies of a Vector, one per node, each allocated and first touched on its node. Readers use the
+// replica of the node they run on. The node that already holds the source shares it copy-on-write instead of
+// copying, so on a single node this is just a shared copy.
+template <typename T>
+class ReplicatedVector
+{
+    std::vector<Vector<T>> replicas;
+
+   public:
+    using value_type = T;
+
+    explicit ReplicatedVector(const Vector<T>& source) : replicas(node_count())
+    {
+        std::optional<std::size_t> home;
+        if (replicas.size() == 1)
+        {
+            home = 0;
+        }
+        else if (const auto node = node_of(source.data()); node && (*node < detail::max_nodes))
+        {
+            home = detail::topology().index[*node];
+        }
+
+        run_on_nodes([&](std::size_t node) {
+            if (node == home)
+            {
+                replicas[node] = source;
+            }
+            else
+            {
+                Vector<T> replica(std::max<std::size_t>(source.size(), 1));
+                replica.append(source.data(), source.data() + source.size());
+                replicas[node] = std::move(replica);
+            }
+        });
+    }
+
+    // The replica of the calling thread's node. Loops should fetch it once rather than index through operator[],
+    // which looks the node up on every call.
+    [[nodiscard]] const Vector<T>& local() const
+    {
+        return replicas[current_node()];
+    }
+
+    [[nodiscard]] const Vector<T>& replica(std::size_t node) const
+    {
+        return replicas.at(node);
+    }
+
+    [[nodiscard]] std::size_t replica_count() const noexcept
+    {
+        return replicas.size();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return replicas[0].size();
+    }
+
+    const T& operator[](std::size_t pos) const
+    {
+        return local()[pos];
+    }
+};
+
+}  // namespace vector::numa
@@ -0,0 +1,256 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <vector/vector.hpp>
+
+namespace vector {
+
+// Read-copy-update publication of Vector snapshots with epoch-based reclamation.
+//
+// Each reader thread claims a cache-line sized slot once (register_reader) and then announces the current
+// epoch in its own slot for the duration of a read guard, so taking a guard writes only reader-private memory.
+// Writers swap in a new version and retire the old one; a retired version is destroyed once every announced
+// reader epoch is newer than the epoch it was retired in.
+template <typename T, std::size_t MaxReaders = 128>
+class PublishedVector
+{
+    static constexpr std::size_t cache_line_size = 64;
+    static constexpr std::uint64_t quiescent = 0;
+
+    struct alignas(cache_line_size) ReaderSlot
+    {
+        std::atomic<std::uint64_t> epoch = quiescent;
+        std::atomic<bool> in_use = false;
+    };
+
+    struct Retired
+    {
+        std::unique_ptr<const Vector<T>> version;
+        std::uint64_t epoch;
+    };
+
+    alignas(cache_line_size) std::atomic<const Vector<T>*> current;
+    alignas(cache_line_size) std::atomic<std::uint64_t> global_epoch = 1;
+    std::array<ReaderSlot, MaxReaders> slots;
+
+    std::mutex writer_mutex;
+    std::vector<Retired> retired;
+
+    [[nodiscard]] std::uint64_t oldest_active_epoch() const noexcept
+    {
+        std::uint64_t oldest = UINT64_MAX;
+        for (const ReaderSlot& slot : slots)
+        {
+            const std::uint64_t epoch = slot.epoch.load(std::memory_order_seq_cst);
+            if ((epoch != quiescent) && (epoch < oldest))
+            {
+                oldest = epoch;
+            }
+        }
+        return oldest;
+    }
+
+    void publish_locked(std::unique_ptr<const Vector<T>> version)
+    {
+        retired.reserve(retired.size() + 1);
+        const Vector<T>* old = current.exchange(version.release(), std::memory_order_seq_cst);
+        const std::uint64_t epoch = global_epoch.fetch_add(1, std::memory_order_seq_cst);
+
+        retired.push_back({std::unique_ptr<const Vector<T>>(old), epoch});
+        reclaim_locked();
+    }
+
+    void reclaim_locked()
+    {
+        const std::uint64_t oldest = oldest_active_epoch();
+        std::erase_if(retired, [oldest](const Retired& entry) { return entry.epoch < oldest; });
+    }
+
+   public:
+    class ReadGuard;
+
+    // Per-thread reader registration. Not thread-safe itself: each reader thread owns one handle, and handles
+    // must not outlive the PublishedVector.
+    class Reader
+    {
+        PublishedVector* owner = nullptr;
+        ReaderSlot* slot = nullptr;
+        std::size_t depth = 0;
+
+        friend class PublishedVector;
+        friend class ReadGuard;
+
+        Reader(PublishedVector* owner, ReaderSlot* slot) : owner(owner), slot(slot)
+        {
+        }
+
+       public:
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        Reader(Reader&& other) noexcept
+            : owner(std::exchange(other.owner, nullptr)), slot(std::exchange(other.slot, nullptr)), depth(0)
+        {
+        }
+
+        ~Reader()
+        {
+            if (slot != nullptr)
+            {
+                slot->epoch.store(quiescent, std::memory_order_release);
+                slot->in_use.store(false, std::memory_order_release);
+            }
+        }
+
+        [[nodiscard]] ReadGuard read()
+        {
+            return ReadGuard(*this);
+        }
+    };
+
+    // Keeps the snapshot it observed alive until destroyed. Wait-free: one load of the epoch, one store to
+    // the reader's own slot and one load of the current version.
+    class ReadGuard
+    {
+        Reader* reader;
+        const Vector<T>* version;
+
+       public:
+        explicit ReadGuard(Reader& owner) : reader(&owner)
+        {
+            if (reader->depth++ == 0)
+            {
+                const std::uint64_t epoch = reader->owner->global_epoch.load(std::memory_order_seq_cst);
+                reader->slot->epoch.store(epoch, std::memory_order_seq_cst);
+            }
+            version = reader->owner->current.load(std::memory_order_seq_cst);
+        }
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        ~ReadGuard()
+        {
+            if (--reader->depth == 0)
+            {
+                reader->slot->epoch.store(quiescent, std::memory_order_release);
+            }
+        }
+
+        // Only const member functions that do not iterate through Vector::Iterator are safe on a shared
+        // snapshot; prefer span() or the pointer-based accessors below.
+        [[nodiscard]] const Vector<T>& vector() const noexcept
+        {
+            return *version;
+        }
+
+        [[nodiscard]] std::span<const T> span() const noexcept
+        {
+            return {version->data(), version->size()};
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return version->size();
+        }
+
+        const T& operator[](std::size_t pos) const
+        {
+            return version->data()[pos];
+        }
+
+        [[nodiscard]] const T* begin() const noexcept
+        {
+            return version->data();
+        }
+
+        [[nodiscard]] const T* end() const noexcept
+        {
+            return version->data() + version->size();
+        }
+    };
+
+    PublishedVector() : current(new Vector<T>())
+    {
+    }
+
+    explicit PublishedVector(Vector<T> initial) : current(new Vector<T>(std::move(initial)))
+    {
+    }
+
+    PublishedVector(const PublishedVector&) = delete;
+    PublishedVector& operator=(const PublishedVector&) = delete;
+
+    ~PublishedVector()
+    {
+        delete current.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] Reader register_reader()
+    {
+        for (ReaderSlot& slot : slots)
+        {
+            bool expected = false;
+            if (!slot.in_use.load(std::memory_order_relaxed)
+                && slot.in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+            {
+                return Reader(this, &slot);
+            }
+        }
+        throw std::length_error("Too many readers");
+    }
+
+    // Copy of the latest version; shares storage with it until either side writes.
+    [[nodiscard]] Vector<T> snapshot()
+    {
+        const std::lock_guard<std::mutex> lock(writer_mutex);
+        return *current.load(std::memory_order_acquire);
+    }
+
+    void publish(Vector<T> next)
+    {
+        auto version = std::make_unique<const Vector<T>>(std::move(next));
+
+        const std::lock_guard<std::mutex> lock(writer_mutex);
+        publish_locked(std::move(version));
+    }
+
+    // Builds the next version from a copy-on-write copy of the current one. Concurrent updates are serialized.
+    template <typename Fn>
+    void update(Fn&& fn)
+    {
+        const std::lock_guard<std::mutex> lock(writer_mutex);
+
+        Vector<T> next = *current.load(std::memory_order_acquire);
+        std::forward<Fn>(fn)(next);
+        publish_locked(std::make_unique<const Vector<T>>(std::move(next)));
+    }
+
+    // Destroys every retired version that no reader can still observe; returns how many remain.
+    std::size_t reclaim()
+    {
+        const std::lock_guard<std::mutex> lock(writer_mutex);
+        reclaim_locked();
+        return retired.size();
+    }
+
+    // Blocks until all previously retired versions have been destroyed.
+    void synchronize()
+    {
+        while (reclaim() != 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+};
+
+}  // namespace vector
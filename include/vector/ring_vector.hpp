@@ -0,0 +1,403 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector/vector.hpp>
+
+namespace vector {
+
+// Double-ended queue over a power-of-two VecStorage buffer. The buffer's own size field stays zero:
+// live elements are the `count` slots starting at `head`, wrapping around the end of the buffer.
+template <typename T>
+class RingVector
+{
+    VecStorage<T> storage;
+    std::size_t head = 0;
+    std::size_t count = 0;
+
+    [[nodiscard]] std::size_t mask() const noexcept
+    {
+        return storage.capacity - 1;
+    }
+
+    [[nodiscard]] T* slot(std::size_t pos) const noexcept
+    {
+        return storage.data + ((head + pos) & mask());
+    }
+
+    void reallocate(std::size_t new_capacity)
+    {
+        VecStorage<T> new_storage(new_capacity);
+        std::size_t moved = 0;
+
+        try
+        {
+            for (; moved < count; moved++)
+            {
+                new (new_storage.data + moved) T(std::move_if_noexcept(*slot(moved)));
+            }
+        }
+        catch (...)
+        {
+            std::destroy_n(new_storage.data, moved);
+            throw;
+        }
+
+        destroy_all();
+        storage.swap(new_storage);
+        head = 0;
+    }
+
+    void destroy_all() noexcept
+    {
+        for (std::size_t pos = 0; pos < count; pos++)
+        {
+            std::destroy_at(slot(pos));
+        }
+    }
+
+    void grow_if_full()
+    {
+        if (count == storage.capacity)
+        {
+            reallocate(std::max<std::size_t>(storage.capacity * vector::factor, 1));
+        }
+    }
+
+   public:
+    using value_type = T;
+
+    RingVector() = default;
+
+    explicit RingVector(std::size_t capacity) : storage(std::bit_ceil(std::max<std::size_t>(capacity, 1)))
+    {
+    }
+
+    // Delegates so that the destructor cleans up the copies made so far if one of them throws.
+    RingVector(const RingVector& other) : RingVector(other.storage.capacity)
+    {
+        for (std::size_t pos = 0; pos < other.count; pos++)
+        {
+            push_back(other[pos]);
+        }
+    }
+
+    RingVector(RingVector&& other) noexcept
+        : storage(std::move(other.storage)), head(std::exchange(other.head, 0)), count(std::exchange(other.count, 0))
+    {
+    }
+
+    RingVector& operator=(RingVector other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~RingVector()
+    {
+        destroy_all();
+    }
+
+    void swap(RingVector& other) noexcept
+    {
+        storage.swap(other.storage);
+        std::swap(head, other.head);
+        std::swap(count, other.count);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return count;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return storage.capacity;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return count == 0;
+    }
+
+    void reserve(std::size_t new_capacity)
+    {
+        if (new_capacity > capacity())
+        {
+            reallocate(std::bit_ceil(new_capacity));
+        }
+    }
+
+    void clear() noexcept
+    {
+        destroy_all();
+        head = 0;
+        count = 0;
+    }
+
+    const T& operator[](std::size_t pos) const
+    {
+        return *slot(pos);
+    }
+
+    T& operator[](std::size_t pos)
+    {
+        return *slot(pos);
+    }
+
+    const T& at(std::size_t pos) const
+    {
+        if (!(pos < size()))
+        {
+            throw std::out_of_range("Pos out of range");
+        }
+        return *slot(pos);
+    }
+
+    T& at(std::size_t pos)
+    {
+        if (!(pos < size()))
+        {
+            throw std::out_of_range("Pos out of range");
+        }
+        return *slot(pos);
+    }
+
+    T& front()
+    {
+        return *slot(0);
+    }
+
+    T& back()
+    {
+        return *slot(count - 1);
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        grow_if_full();
+        T* place = new (slot(count)) T(std::forward<Args>(args)...);
+        ++count;
+        return *place;
+    }
+
+    template <typename... Args>
+    T& emplace_front(Args&&... args)
+    {
+        grow_if_full();
+        const std::size_t new_head = (head - 1) & mask();
+        T* place = new (storage.data + new_head) T(std::forward<Args>(args)...);
+        head = new_head;
+        ++count;
+        return *place;
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    void push_front(const T& value)
+    {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value)
+    {
+        emplace_front(std::move(value));
+    }
+
+    void pop_back()
+    {
+        --count;
+        std::destroy_at(slot(count));
+    }
+
+    void pop_front()
+    {
+        std::destroy_at(slot(0));
+        head = (head + 1) & mask();
+        --count;
+    }
+
+    // The live elements as at most two contiguous runs, in queue order.
+    [[nodiscard]] std::pair<std::span<T>, std::span<T>> spans() noexcept
+    {
+        const std::size_t first = std::min(count, storage.capacity - head);
+        return {std::span<T>(storage.data + head, first), std::span<T>(storage.data, count - first)};
+    }
+
+    [[nodiscard]] std::pair<std::span<const T>, std::span<const T>> spans() const noexcept
+    {
+        const std::size_t first = std::min(count, storage.capacity - head);
+        return {std::span<const T>(storage.data + head, first), std::span<const T>(storage.data, count - first)};
+    }
+};
+
+// Fixed-capacity single-producer/single-consumer queue. Producer and consumer indices live on separate cache
+// lines, and each side caches the other's index so the shared line is only read when the queue looks full or
+// empty.
+template <typename T>
+class SpscRingVector
+{
+    static constexpr std::size_t cache_line_size = 64;
+
+    VecStorage<T> storage;
+
+    alignas(cache_line_size) std::atomic<std::size_t> head = 0;
+    std::size_t cached_tail = 0;
+
+    alignas(cache_line_size) std::atomic<std::size_t> tail = 0;
+    std::size_t cached_head = 0;
+
+    [[nodiscard]] T* slot(std::size_t index) const noexcept
+    {
+        return storage.data + (index & (storage.capacity - 1));
+    }
+
+   public:
+    using value_type = T;
+
+    explicit SpscRingVector(std::size_t capacity) : storage(std::bit_ceil(std::max<std::size_t>(capacity, 1)))
+    {
+    }
+
+    SpscRingVector(const SpscRingVector&) = delete;
+    SpscRingVector& operator=(const SpscRingVector&) = delete;
+
+    ~SpscRingVector()
+    {
+        const std::size_t last = tail.load(std::memory_order_relaxed);
+        for (std::size_t index = head.load(std::memory_order_relaxed); index != last; index++)
+        {
+            std::destroy_at(slot(index));
+        }
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return storage.capacity;
+    }
+
+    [[nodiscard]] std::size_t size_approx() const noexcept
+    {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+
+    // Producer side.
+    template <typename... Args>
+    bool try_emplace(Args&&... args)
+    {
+        const std::size_t index = tail.load(std::memory_order_relaxed);
+
+        if (index - cached_head == storage.capacity)
+        {
+            cached_head = head.load(std::memory_order_acquire);
+            if (index - cached_head == storage.capacity)
+            {
+                return false;
+            }
+        }
+
+        new (slot(index)) T(std::forward<Args>(args)...);
+        tail.store(index + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const T& value)
+    {
+        return try_emplace(value);
+    }
+
+    bool try_push(T&& value)
+    {
+        return try_emplace(std::move(value));
+    }
+
+    // Producer side: copies as many leading values as fit and publishes them with a single store.
+    std::size_t push_bulk(std::span<const T> values)
+    {
+        const std::size_t index = tail.load(std::memory_order_relaxed);
+
+        if (storage.capacity - (index - cached_head) < values.size())
+        {
+            cached_head = head.load(std::memory_order_acquire);
+        }
+
+        const std::size_t pushed = std::min(values.size(), storage.capacity - (index - cached_head));
+        std::size_t i = 0;
+        try
+        {
+            for (; i < pushed; i++)
+            {
+                new (slot(index + i)) T(values[i]);
+            }
+        }
+        catch (...)
+        {
+            for (std::size_t placed = 0; placed < i; placed++)
+            {
+                std::destroy_at(slot(index + placed));
+            }
+            throw;
+        }
+
+        tail.store(index + pushed, std::memory_order_release);
+        return pushed;
+    }
+
+    // Consumer side.
+    std::optional<T> try_pop()
+    {
+        const std::size_t index = head.load(std::memory_order_relaxed);
+
+        if (index == cached_tail)
+        {
+            cached_tail = tail.load(std::memory_order_acquire);
+            if (index == cached_tail)
+            {
+                return std::nullopt;
+            }
+        }
+
+        std::optional<T> value(std::move(*slot(index)));
+        std::destroy_at(slot(index));
+        head.store(index + 1, std::memory_order_release);
+        return value;
+    }
+
+    // Consumer side: moves up to out.size() values into out and releases their slots with a single store.
+    std::size_t pop_bulk(std::span<T> out)
+    {
+        const std::size_t index = head.load(std::memory_order_relaxed);
+
+        if (cached_tail - index < out.size())
+        {
+            cached_tail = tail.load(std::memory_order_acquire);
+        }
+
+        const std::size_t popped = std::min(out.size(), cached_tail - index);
+        for (std::size_t i = 0; i < popped; i++)
+        {
+            out[i] = std::move(*slot(index + i));
+            std::destroy_at(slot(index + i));
+        }
+
+        head.store(index + popped, std::memory_order_release);
+        return popped;
+    }
+};
+
+}  // namespace vector
@@ -0,0 +1,98 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector/vector.hpp>
+
+namespace vector {
+
+// Lower bound over a sorted range whose loop body compiles to a conditional move instead of a branch.
+template <typename K, typename Compare = std::less<K>>
+constexpr std::size_t branchless_lower_bound(const K* data, std::size_t size, const K& key, Compare comp = Compare{})
+{
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    const K* base = data;
+
+    while (size > 1)
+    {
+        const std::size_t half = size / 2;
+        base = comp(base[half], key) ? base + half : base;
+        size -= half;
+    }
+
+    return static_cast<std::size_t>(base - data) + static_cast<std::size_t>(comp(*base, key));
+}
+
+// Read-only copy of a sorted range in Eytzinger (BFS) order. Lookups walk the implicit tree from the root,
+// touching one cache line per level, and prefetch several levels ahead.
+template <typename K, typename Compare = std::less<K>>
+class EytzingerIndex
+{
+    Vector<K> tree;
+    Vector<std::size_t> positions;
+    Compare comp;
+
+    std::size_t build(std::size_t next, std::size_t node)
+    {
+        if (node <= positions.size())
+        {
+            next = build(next, 2 * node);
+            positions[node - 1] = next;
+            next = build(next + 1, 2 * node + 1);
+        }
+        return next;
+    }
+
+   public:
+    explicit EytzingerIndex(Compare comp = Compare{}) : comp(comp)
+    {
+    }
+
+    EytzingerIndex(const K* sorted, std::size_t size, Compare comp = Compare{}) : comp(comp)
+    {
+        positions.resize(size);
+        build(0, 1);
+
+        tree.reserve(size);
+        for (std::size_t i = 0; i < size; i++)
+        {
+            tree.push_back(sorted[std::as_const(positions)[i]]);
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return tree.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return tree.empty();
+    }
+
+    // Returns the position of the first element not less than key in the original sorted range.
+    [[nodiscard]] std::size_t lower_bound(const K& key) const
+    {
+        const K* nodes = tree.data();
+        const std::size_t count = tree.size();
+        std::size_t node = 1;
+
+        while (node <= count)
+        {
+#if defined(__GNUC__)
+            __builtin_prefetch(nodes + 16 * node);
+#endif
+            node = 2 * node + static_cast<std::size_t>(comp(nodes[node - 1], key));
+        }
+
+        node >>= static_cast<unsigned>(std::countr_one(node)) + 1;
+        return node == 0 ? count : positions[node - 1];
+    }
+};
+
+}  // namespace vector
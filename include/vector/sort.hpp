@@ -0,0 +1,490 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <vector/vector.hpp>
+
+// Sorting for Vector. Integral and floating-point keys go through an LSD radix sort (one byte per pass, passes
+// in which every key has the same byte skipped). Inputs larger than the cache are first split on their top byte,
+// in parallel for very large ones, so that the LSD passes over each bucket stay in cache; short runs go through
+// a branchless sorting network. Other types use std::sort on the contiguous buffer.
+//
+// Floating-point keys are ordered by their bit pattern: -0.0 sorts before 0.0, and NaNs sort below every
+// number if their sign bit is set and above otherwise.
+
+namespace vector {
+
+template <typename T>
+concept RadixKey = (std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_same_v<T, float>
+                   || std::is_same_v<T, double>;
+
+// Temporary storage for the radix passes; every thread keeps one and reuses it across calls.
+class SortScratch
+{
+    std::unique_ptr<std::byte[]> buffer;
+    std::size_t bytes = 0;
+
+   public:
+    // At least `size` bytes aligned for any scalar type. The previous contents are not kept.
+    std::byte* reserve(std::size_t size)
+    {
+        if (size > bytes)
+        {
+            buffer.reset();
+            buffer = std::make_unique_for_overwrite<std::byte[]>(size);
+            bytes = size;
+        }
+        return buffer.get();
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return bytes;
+    }
+
+    void release() noexcept
+    {
+        buffer.reset();
+        bytes = 0;
+    }
+};
+
+inline SortScratch& sort_scratch()
+{
+    thread_local SortScratch scratch;
+    return scratch;
+}
+
+namespace detail {
+
+// Inputs at least this large are split on the top byte first, and from the second size on with several threads.
+inline constexpr std::size_t msd_sort_threshold = std::size_t{1} << 16;
+inline constexpr std::size_t parallel_sort_threshold = std::size_t{1} << 21;
+inline constexpr std::size_t min_elements_per_thread = std::size_t{1} << 18;
+inline constexpr std::size_t network_size = 16;
+inline constexpr std::size_t insertion_sort_threshold = 64;
+inline constexpr std::size_t radix = 256;
+
+using Histogram = std::array<std::size_t, radix>;
+
+template <typename T>
+struct radix_image : std::make_unsigned<T>
+{
+};
+
+template <>
+struct radix_image<float>
+{
+    using type = std::uint32_t;
+};
+
+template <>
+struct radix_image<double>
+{
+    using type = std::uint64_t;
+};
+
+template <RadixKey T>
+using radix_t = typename radix_image<T>::type;
+
+// Maps keys to unsigned integers with the same order.
+template <RadixKey T>
+constexpr radix_t<T> to_radix(T key) noexcept
+{
+    using U = radix_t<T>;
+    constexpr U sign = U{1} << (std::numeric_limits<U>::digits - 1);
+
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        const auto bits = std::bit_cast<U>(key);
+        return ((bits & sign) != 0) ? static_cast<U>(~bits) : static_cast<U>(bits | sign);
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<U>(static_cast<U>(key) ^ sign);
+    }
+    else
+    {
+        return key;
+    }
+}
+
+template <RadixKey T>
+constexpr T from_radix(radix_t<T> bits) noexcept
+{
+    using U = radix_t<T>;
+    constexpr U sign = U{1} << (std::numeric_limits<U>::digits - 1);
+
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return std::bit_cast<T>(((bits & sign) != 0) ? static_cast<U>(bits ^ sign) : static_cast<U>(~bits));
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<T>(static_cast<U>(bits ^ sign));
+    }
+    else
+    {
+        return bits;
+    }
+}
+
+template <RadixKey T>
+constexpr std::size_t digit(T key, std::size_t pass) noexcept
+{
+    return static_cast<std::size_t>((to_radix(key) >> (8 * pass)) & 0xFF);
+}
+
+// Green's 16-input network, 60 comparators in 10 layers.
+inline constexpr std::array<std::pair<std::uint8_t, std::uint8_t>, 60> network16{{
+    {0, 13}, {1, 12}, {2, 15}, {3, 14}, {4, 8},   {5, 6},   {7, 11},  {9, 10},  {0, 5},   {1, 7},   {2, 9},  {3, 4},
+    {6, 13}, {8, 14}, {10, 15}, {11, 12}, {0, 1}, {2, 3},   {4, 5},   {6, 8},   {7, 9},   {10, 11}, {12, 13}, {14, 15},
+    {0, 2},  {1, 3},  {4, 10},  {5, 11},  {6, 7}, {8, 9},   {12, 14}, {13, 15}, {1, 2},   {3, 12},  {4, 6},   {5, 7},
+    {8, 10}, {9, 11}, {13, 14}, {1, 4},   {2, 6}, {5, 8},   {7, 10},  {9, 13},  {11, 14}, {2, 4},   {3, 6},   {9, 12},
+    {11, 13}, {3, 5}, {6, 8},   {7, 9},   {10, 12}, {3, 4}, {5, 6},   {7, 8},   {9, 10},  {11, 12}, {6, 7},   {8, 9},
+}};
+
+// Sorts up to 16 keys with min/max on their radix images, which compile to conditional moves or vector min/max
+// instead of branches. Unused slots hold the largest image and stay at the end.
+template <RadixKey K>
+void network_sort(K* keys, std::size_t count) noexcept
+{
+    using U = radix_t<K>;
+    std::array<U, network_size> lanes;
+    lanes.fill(std::numeric_limits<U>::max());
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        lanes[i] = to_radix(keys[i]);
+    }
+    for (const auto& [lo, hi] : network16)
+    {
+        const U a = lanes[lo];
+        const U b = lanes[hi];
+        lanes[lo] = std::min(a, b);
+        lanes[hi] = std::max(a, b);
+    }
+    for (std::size_t i = 0; i < count; i++)
+    {
+        keys[i] = from_radix<K>(lanes[i]);
+    }
+}
+
+// Stable; moves the payload along with the keys.
+template <RadixKey K, typename P>
+void insertion_sort(K* keys, P* values, std::size_t count) noexcept
+{
+    for (std::size_t i = 1; i < count; i++)
+    {
+        const K key = keys[i];
+        const auto bits = to_radix(key);
+        std::size_t j = i;
+
+        if constexpr (std::is_void_v<P>)
+        {
+            for (; (j > 0) && (to_radix(keys[j - 1]) > bits); j--)
+            {
+                keys[j] = keys[j - 1];
+            }
+        }
+        else
+        {
+            const P value = values[i];
+            for (; (j > 0) && (to_radix(keys[j - 1]) > bits); j--)
+            {
+                keys[j] = keys[j - 1];
+                values[j] = values[j - 1];
+            }
+            values[j] = value;
+        }
+        keys[j] = key;
+    }
+}
+
+// Stable sort of keys (and the payload, unless P is void) by their low `passes` bytes. The buffers must hold
+// `count` elements; returns true if the result ended up in them rather than in keys and values.
+template <RadixKey K, typename P>
+bool radix_passes(K* keys, K* key_buffer, P* values, P* value_buffer, std::size_t count, std::size_t passes) noexcept
+{
+    if (count <= insertion_sort_threshold)
+    {
+        if (std::is_void_v<P> && (count <= network_size))
+        {
+            network_sort(keys, count);
+        }
+        else
+        {
+            insertion_sort(keys, values, count);
+        }
+        return false;
+    }
+
+    std::array<Histogram, sizeof(K)> histograms{};
+    for (std::size_t i = 0; i < count; i++)
+    {
+        const auto bits = to_radix(keys[i]);
+        for (std::size_t pass = 0; pass < sizeof(K); pass++)
+        {
+            ++histograms[pass][(bits >> (8 * pass)) & 0xFF];
+        }
+    }
+
+    K* src = keys;
+    K* dst = key_buffer;
+    P* value_src = values;
+    P* value_dst = value_buffer;
+
+    for (std::size_t pass = 0; pass < passes; pass++)
+    {
+        Histogram& offsets = histograms[pass];
+        if (offsets[digit(src[0], pass)] == count)
+        {
+            continue;
+        }
+
+        std::exclusive_scan(offsets.begin(), offsets.end(), offsets.begin(), std::size_t{0});
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const std::size_t slot = offsets[digit(src[i], pass)]++;
+            dst[slot] = src[i];
+            if constexpr (!std::is_void_v<P>)
+            {
+                value_dst[slot] = value_src[i];
+            }
+        }
+
+        std::swap(src, dst);
+        std::swap(value_src, value_dst);
+    }
+
+    return src != keys;
+}
+
+template <typename P>
+void copy_payload(const P* src, P* dst, std::size_t count) noexcept
+{
+    if constexpr (!std::is_void_v<P>)
+    {
+        std::copy_n(src, count, dst);
+    }
+}
+
+template <typename Body>
+void run_parallel(std::size_t threads, Body body)
+{
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (std::size_t t = 1; t < threads; t++)
+    {
+        workers.emplace_back(body, t);
+    }
+    body(0);
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+// Splits on the top byte with every thread histogramming and scattering its own slice, then sorts the 256
+// buckets by the remaining bytes, handing them out to threads as they finish. Skewed keys that land in one
+// bucket are finished by one thread.
+template <RadixKey K, typename P>
+void msd_radix_sort(K* keys, K* key_buffer, P* values, P* value_buffer, std::size_t count, std::size_t threads)
+{
+    constexpr std::size_t top = sizeof(K) - 1;
+    const std::size_t slice = (count + threads - 1) / threads;
+    std::vector<Histogram> offsets(threads, Histogram{});
+
+    run_parallel(threads, [&](std::size_t t) {
+        const std::size_t end = std::min(count, (t + 1) * slice);
+        for (std::size_t i = t * slice; i < end; i++)
+        {
+            ++offsets[t][digit(keys[i], top)];
+        }
+    });
+
+    std::array<std::size_t, radix + 1> bucket_begin{};
+    std::size_t next = 0;
+    for (std::size_t bucket = 0; bucket < radix; bucket++)
+    {
+        bucket_begin[bucket] = next;
+        for (Histogram& histogram : offsets)
+        {
+            const std::size_t size = histogram[bucket];
+            histogram[bucket] = next;
+            next += size;
+        }
+    }
+    bucket_begin[radix] = count;
+
+    run_parallel(threads, [&](std::size_t t) {
+        Histogram& slots = offsets[t];
+        const std::size_t end = std::min(count, (t + 1) * slice);
+        for (std::size_t i = t * slice; i < end; i++)
+        {
+            const std::size_t slot = slots[digit(keys[i], top)]++;
+            key_buffer[slot] = keys[i];
+            if constexpr (!std::is_void_v<P>)
+            {
+                value_buffer[slot] = values[i];
+            }
+        }
+    });
+
+    std::atomic<std::size_t> next_bucket{0};
+    run_parallel(threads, [&](std::size_t /*t*/) {
+        for (std::size_t bucket = next_bucket++; bucket < radix; bucket = next_bucket++)
+        {
+            const std::size_t begin = bucket_begin[bucket];
+            const std::size_t size = bucket_begin[bucket + 1] - begin;
+            if (size == 0)
+            {
+                continue;
+            }
+
+            P* bucket_values = nullptr;
+            P* bucket_value_buffer = nullptr;
+            if constexpr (!std::is_void_v<P>)
+            {
+                bucket_values = value_buffer + begin;
+                bucket_value_buffer = values + begin;
+            }
+
+            if (!radix_passes(key_buffer + begin, keys + begin, bucket_values, bucket_value_buffer, size, top))
+            {
+                std::copy_n(key_buffer + begin, size, keys + begin);
+                if constexpr (!std::is_void_v<P>)
+                {
+                    std::copy_n(value_buffer + begin, size, values + begin);
+                }
+            }
+        }
+    });
+}
+
+[[nodiscard]] inline std::size_t sort_threads(std::size_t count) noexcept
+{
+    if (count < parallel_sort_threshold)
+    {
+        return 1;
+    }
+    const std::size_t hardware = std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+    return std::min(hardware, count / min_elements_per_thread);
+}
+
+[[nodiscard]] constexpr std::size_t align_up(std::size_t bytes, std::size_t alignment) noexcept
+{
+    return (bytes + alignment - 1) / alignment * alignment;
+}
+
+template <RadixKey K, typename P>
+void radix_sort(K* keys, P* values, std::size_t count, SortScratch& scratch)
+{
+    if (count < 2)
+    {
+        return;
+    }
+
+    std::size_t bytes = sizeof(K) * count;
+    std::size_t value_offset = 0;
+    if constexpr (!std::is_void_v<P>)
+    {
+        value_offset = align_up(bytes, alignof(P));
+        bytes = value_offset + sizeof(P) * count;
+    }
+
+    std::byte* buffer = (count > insertion_sort_threshold) ? scratch.reserve(bytes) : nullptr;
+    auto* key_buffer = reinterpret_cast<K*>(buffer);
+    P* value_buffer = nullptr;
+    if constexpr (!std::is_void_v<P>)
+    {
+        value_buffer = reinterpret_cast<P*>(buffer + value_offset);
+    }
+
+    if ((sizeof(K) > 1) && (count >= msd_sort_threshold))
+    {
+        msd_radix_sort(keys, key_buffer, values, value_buffer, count, sort_threads(count));
+        return;
+    }
+
+    if (radix_passes(keys, key_buffer, values, value_buffer, count, sizeof(K)))
+    {
+        std::copy_n(key_buffer, count, keys);
+        copy_payload(value_buffer, values, count);
+    }
+}
+
+}  // namespace detail
+
+// Sorts in ascending order. Radix keys are sorted stably with the radix sort; other types with std::sort.
+template <typename T>
+void sort(Vector<T>& vec, SortScratch& scratch = sort_scratch())
+{
+    if constexpr (RadixKey<T>)
+    {
+        detail::radix_sort<T, void>(vec.data(), nullptr, vec.size(), scratch);
+    }
+    else
+    {
+        std::sort(vec.data(), vec.data() + vec.size());
+    }
+}
+
+template <typename T, typename Compare>
+    requires std::predicate<Compare&, const T&, const T&>
+void sort(Vector<T>& vec, Compare comp)
+{
+    T* data = vec.data();
+    std::sort(data, data + vec.size(), comp);
+}
+
+// Sorts keys and applies the same permutation to values; equal keys keep their order. Trivially copyable values
+// move through the radix passes with their keys; others are permuted once at the end.
+template <RadixKey K, typename V>
+void sort_by_key(Vector<K>& keys, Vector<V>& values, SortScratch& scratch = sort_scratch())
+{
+    if (keys.size() != values.size())
+    {
+        throw std::invalid_argument("Vector sizes do not match");
+    }
+
+    const std::size_t count = keys.size();
+
+    if constexpr (std::is_trivially_copyable_v<V>)
+    {
+        detail::radix_sort(keys.data(), values.data(), count, scratch);
+    }
+    else
+    {
+        Vector<std::size_t> order(std::max<std::size_t>(count, 1));
+        order.resize(count);
+        std::iota(order.data(), order.data() + count, std::size_t{0});
+
+        detail::radix_sort(keys.data(), order.data(), count, scratch);
+
+        V* source = values.data();
+        const std::size_t capacity = std::max<std::size_t>(count, 1);
+        Vector<V> permuted = (values.arena() != nullptr) ? Vector<V>(capacity, *values.arena()) : Vector<V>(capacity);
+        for (const std::size_t index : std::span<const std::size_t>(std::as_const(order).data(), count))
+        {
+            permuted.push_back(std::move(source[index]));
+        }
+        values.swap(permuted);
+    }
+}
+
+}  // namespace vector
@@ -0,0 +1,282 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector/index_iterator.hpp>
+#include <vector/vector.hpp>
+
+namespace vector {
+
+// Sequence that never relocates its elements. Storage is a directory of VecStorage segments where segment k holds
+// first_segment << k elements starting at index first_segment * (2^k - 1), so growing allocates one more segment
+// instead of copying, and references, pointers and iterators stay valid across push_back and reserve.
+template <typename T>
+class StableVector
+{
+   public:
+    static constexpr std::size_t first_segment_shift = 4;
+    static constexpr std::size_t first_segment = std::size_t{1} << first_segment_shift;
+
+   private:
+    static constexpr std::size_t initial_directory = 8;
+
+    // Each segment's size counts its constructed elements and the directory's size counts allocated segments, so
+    // destroying the directory destroys everything.
+    VecStorage<VecStorage<T>> directory;
+    std::size_t count = 0;
+    Arena* arena = nullptr;
+
+    struct Position
+    {
+        std::size_t segment;
+        std::size_t offset;
+    };
+
+    // Biasing the index by first_segment makes the segment number the position of the highest set bit.
+    static Position locate(std::size_t pos) noexcept
+    {
+        const std::size_t biased = pos + first_segment;
+        const std::size_t segment = std::bit_width(biased) - 1 - first_segment_shift;
+        return {segment, biased - (first_segment << segment)};
+    }
+
+    static constexpr std::size_t capacity_of(std::size_t segments) noexcept
+    {
+        return first_segment * ((std::size_t{1} << segments) - 1);
+    }
+
+    [[nodiscard]] T* slot(std::size_t pos) const noexcept
+    {
+        const auto [segment, offset] = locate(pos);
+        return directory.data[segment].data + offset;
+    }
+
+    void add_segment()
+    {
+        if (directory.size == directory.capacity)
+        {
+            VecStorage<VecStorage<T>> grown(std::max(directory.capacity * 2, initial_directory), arena);
+            for (std::size_t segment = 0; segment < directory.size; segment++)
+            {
+                new (grown.data + segment) VecStorage<T>(std::move(directory.data[segment]));
+            }
+            // The moved-from headers own nothing, so they are dropped without running their destructors.
+            grown.size = std::exchange(directory.size, 0);
+            directory.swap(grown);
+        }
+
+        new (directory.data + directory.size) VecStorage<T>(first_segment << directory.size, arena);
+        ++directory.size;
+    }
+
+   public:
+    using value_type = T;
+    using iterator = IndexIterator<StableVector, false>;
+    using const_iterator = IndexIterator<StableVector, true>;
+
+    StableVector() : directory(initial_directory)
+    {
+    }
+
+    explicit StableVector(Arena& arena) : directory(initial_directory, &arena), arena(&arena)
+    {
+    }
+
+    StableVector(const StableVector& other) = default;
+
+    StableVector(StableVector&& other) noexcept
+        : directory(std::move(other.directory)), count(std::exchange(other.count, 0)), arena(other.arena)
+    {
+    }
+
+    StableVector& operator=(StableVector other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~StableVector() = default;
+
+    void swap(StableVector& other) noexcept
+    {
+        directory.swap(other.directory);
+        std::swap(count, other.count);
+        std::swap(arena, other.arena);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return count;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return capacity_of(directory.size);
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return count == 0;
+    }
+
+    // Allocates segments up to new_capacity; existing elements are not touched.
+    void reserve(std::size_t new_capacity)
+    {
+        while (capacity() < new_capacity)
+        {
+            add_segment();
+        }
+    }
+
+    // Frees the trailing segments that hold no elements.
+    void shrink_to_fit() noexcept
+    {
+        while ((directory.size > 0) && (directory.data[directory.size - 1].size == 0))
+        {
+            --directory.size;
+            std::destroy_at(directory.data + directory.size);
+        }
+    }
+
+    void clear() noexcept
+    {
+        for (std::size_t segment = 0; segment < directory.size; segment++)
+        {
+            VecStorage<T>& storage = directory.data[segment];
+            std::destroy_n(storage.data, storage.size);
+            storage.size = 0;
+        }
+        count = 0;
+    }
+
+    const T& operator[](std::size_t pos) const
+    {
+        return *slot(pos);
+    }
+
+    T& operator[](std::size_t pos)
+    {
+        return *slot(pos);
+    }
+
+    const T& at(std::size_t pos) const
+    {
+        if (!(pos < size()))
+        {
+            throw std::out_of_range("Pos out of range");
+        }
+        return *slot(pos);
+    }
+
+    T& at(std::size_t pos)
+    {
+        if (!(pos < size()))
+        {
+            throw std::out_of_range("Pos out of range");
+        }
+        return *slot(pos);
+    }
+
+    T& front()
+    {
+        return *slot(0);
+    }
+
+    const T& front() const
+    {
+        return *slot(0);
+    }
+
+    T& back()
+    {
+        return *slot(count - 1);
+    }
+
+    const T& back() const
+    {
+        return *slot(count - 1);
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (count == capacity())
+        {
+            add_segment();
+        }
+
+        const auto [segment, offset] = locate(count);
+        VecStorage<T>& storage = directory.data[segment];
+        T* place = new (storage.data + offset) T(std::forward<Args>(args)...);
+        ++storage.size;
+        ++count;
+        return *place;
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    void pop_back()
+    {
+        --count;
+        const auto [segment, offset] = locate(count);
+        VecStorage<T>& storage = directory.data[segment];
+        std::destroy_at(storage.data + offset);
+        --storage.size;
+    }
+
+    // Number of allocated segments, and the elements of one of them; iterating segment by segment visits every
+    // element through contiguous spans.
+    [[nodiscard]] std::size_t segment_count() const noexcept
+    {
+        return directory.size;
+    }
+
+    [[nodiscard]] std::span<T> segment(std::size_t index) noexcept
+    {
+        return std::span<T>(directory.data[index].data, directory.data[index].size);
+    }
+
+    [[nodiscard]] std::span<const T> segment(std::size_t index) const noexcept
+    {
+        return std::span<const T>(directory.data[index].data, directory.data[index].size);
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+    iterator end() noexcept
+    {
+        return iterator(this, count);
+    }
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, count);
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+};
+
+}  // namespace vector
@@ -0,0 +1,264 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+namespace vector {
+
+// Size-class cache for storage buffers. Freed buffers are kept on a per-thread free list bucketed by
+// power-of-two byte size; a thread whose cache exceeds its byte budget (or that exits) hands the surplus
+// to a shared depot, from which any thread can refill before falling back to the global allocator.
+class StoragePool
+{
+   public:
+    static constexpr std::size_t min_class_shift = 4;
+    static constexpr std::size_t class_count = 24;
+    static constexpr std::size_t max_class_size = std::size_t{1} << (min_class_shift + class_count - 1);
+    static constexpr std::size_t default_thread_budget = std::size_t{8} << 20;
+    static constexpr std::size_t default_depot_budget = std::size_t{64} << 20;
+
+    struct Stats
+    {
+        std::size_t hits = 0;
+        std::size_t depot_hits = 0;
+        std::size_t misses = 0;
+        std::size_t releases = 0;
+        std::size_t spills = 0;
+        std::size_t frees = 0;
+
+        [[nodiscard]] double hit_rate() const noexcept
+        {
+            const std::size_t total = hits + depot_hits + misses;
+            return total == 0 ? 0.0 : static_cast<double>(hits + depot_hits) / static_cast<double>(total);
+        }
+    };
+
+   private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    struct Depot
+    {
+        std::mutex mutex;
+        std::array<FreeBlock*, class_count> heads{};
+        std::atomic<std::size_t> bytes = 0;
+
+        ~Depot()
+        {
+            for (FreeBlock* head : heads)
+            {
+                release_list(head);
+            }
+        }
+    };
+
+    struct ThreadCache
+    {
+        std::array<FreeBlock*, class_count> heads{};
+        std::size_t bytes = 0;
+        Stats stats;
+
+        ~ThreadCache()
+        {
+            flush();
+            cache_destroyed = true;
+        }
+
+        void flush() noexcept
+        {
+            for (std::size_t index = 0; index < class_count; index++)
+            {
+                while (heads[index] != nullptr)
+                {
+                    FreeBlock* block = heads[index];
+                    heads[index] = block->next;
+                    spill(block, index, stats);
+                }
+            }
+            bytes = 0;
+        }
+    };
+
+    static inline std::atomic<bool> enabled_flag = false;
+    static inline thread_local bool cache_destroyed = false;
+    static inline std::atomic<std::size_t> thread_budget = default_thread_budget;
+    static inline std::atomic<std::size_t> depot_budget = default_depot_budget;
+
+    static Depot& depot()
+    {
+        static Depot instance;
+        return instance;
+    }
+
+    static ThreadCache& cache()
+    {
+        thread_local ThreadCache instance;
+        return instance;
+    }
+
+    static constexpr std::size_t class_index(std::size_t bytes) noexcept
+    {
+        const std::size_t rounded = std::bit_ceil(std::max(bytes, std::size_t{1} << min_class_shift));
+        return static_cast<std::size_t>(std::countr_zero(rounded)) - min_class_shift;
+    }
+
+    static constexpr std::size_t class_size(std::size_t index) noexcept
+    {
+        return std::size_t{1} << (index + min_class_shift);
+    }
+
+    static void release_list(FreeBlock* head) noexcept
+    {
+        while (head != nullptr)
+        {
+            FreeBlock* next = head->next;
+            operator delete(head);
+            head = next;
+        }
+    }
+
+    static void spill(FreeBlock* block, std::size_t index, Stats& stats) noexcept
+    {
+        Depot& shared = depot();
+        const std::size_t size = class_size(index);
+
+        if (shared.bytes.load(std::memory_order_relaxed) + size <= depot_budget.load(std::memory_order_relaxed))
+        {
+            const std::lock_guard<std::mutex> lock(shared.mutex);
+            block->next = shared.heads[index];
+            shared.heads[index] = block;
+            shared.bytes.fetch_add(size, std::memory_order_relaxed);
+            ++stats.spills;
+            return;
+        }
+
+        operator delete(block);
+        ++stats.frees;
+    }
+
+    static FreeBlock* refill(std::size_t index) noexcept
+    {
+        Depot& shared = depot();
+
+        if (shared.bytes.load(std::memory_order_relaxed) == 0)
+        {
+            return nullptr;
+        }
+
+        const std::lock_guard<std::mutex> lock(shared.mutex);
+        FreeBlock* block = shared.heads[index];
+
+        if (block != nullptr)
+        {
+            shared.heads[index] = block->next;
+            shared.bytes.fetch_sub(class_size(index), std::memory_order_relaxed);
+        }
+        return block;
+    }
+
+   public:
+    static void enable(bool enabled) noexcept
+    {
+        enabled_flag.store(enabled, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static bool enabled() noexcept
+    {
+        return enabled_flag.load(std::memory_order_relaxed);
+    }
+
+    static void set_thread_budget(std::size_t bytes) noexcept
+    {
+        thread_budget.store(bytes, std::memory_order_relaxed);
+    }
+
+    static void set_depot_budget(std::size_t bytes) noexcept
+    {
+        depot_budget.store(bytes, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static void* allocate(std::size_t bytes)
+    {
+        if ((bytes > max_class_size) || cache_destroyed)
+        {
+            return operator new(std::max(bytes, std::size_t{1} << min_class_shift));
+        }
+
+        const std::size_t index = class_index(bytes);
+        ThreadCache& local = cache();
+
+        if (FreeBlock* block = local.heads[index]; block != nullptr)
+        {
+            local.heads[index] = block->next;
+            local.bytes -= class_size(index);
+            ++local.stats.hits;
+            return block;
+        }
+
+        if (FreeBlock* block = refill(index); block != nullptr)
+        {
+            ++local.stats.depot_hits;
+            return block;
+        }
+
+        ++local.stats.misses;
+        return operator new(class_size(index));
+    }
+
+    static void deallocate(void* ptr, std::size_t bytes) noexcept
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+        if ((bytes > max_class_size) || cache_destroyed)
+        {
+            operator delete(ptr);
+            return;
+        }
+
+        const std::size_t index = class_index(bytes);
+        ThreadCache& local = cache();
+        auto* block = new (ptr) FreeBlock{nullptr};
+
+        if (local.bytes + class_size(index) > thread_budget.load(std::memory_order_relaxed))
+        {
+            spill(block, index, local.stats);
+            return;
+        }
+
+        block->next = local.heads[index];
+        local.heads[index] = block;
+        local.bytes += class_size(index);
+        ++local.stats.releases;
+    }
+
+    // Returns every buffer cached by the calling thread to the shared depot.
+    static void trim() noexcept
+    {
+        cache().flush();
+    }
+
+    [[nodiscard]] static Stats thread_stats() noexcept
+    {
+        return cache().stats;
+    }
+
+    static void reset_thread_stats() noexcept
+    {
+        cache().stats = Stats{};
+    }
+
+    [[nodiscard]] static std::size_t thread_cached_bytes() noexcept
+    {
+        return cache().bytes;
+    }
+};
+
+}  // namespace vector
@@ -0,0 +1,353 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector/index_iterator.hpp>
+#include <vector/vector.hpp>
+
+namespace vector {
+
+// Sequence of strings whose characters live back to back in one growing buffer, with an {offset, length} entry per
+// element. Elements are std::string_views into that buffer, valid until the next mutation. Appending costs no
+// allocation per string, iteration reads memory in order, and copies share both buffers like Vector does, so an
+// unshared copy is two memcpys rather than one allocation per string.
+//
+// Erasing or replacing an element leaves its old characters behind as garbage. Once garbage outweighs the live
+// characters, the next such mutation compacts the buffer, so the space stays within twice the live size.
+class StringVector
+{
+    struct Entry
+    {
+        std::size_t offset;
+        std::size_t length;
+    };
+
+    Vector<char> chars;
+    Vector<Entry> entries;
+    std::size_t garbage = 0;
+
+    [[nodiscard]] const Entry& entry(std::size_t pos) const noexcept
+    {
+        return std::as_const(entries).data()[pos];
+    }
+
+    void append_chars(std::string_view value)
+    {
+        chars.append(value.data(), value.data() + value.size());
+    }
+
+    void compact_if_sparse()
+    {
+        if (garbage > chars.size() - garbage)
+        {
+            compact();
+        }
+    }
+
+   public:
+    using value_type = std::string_view;
+    using iterator = IndexIterator<StringVector, true>;
+    using const_iterator = iterator;
+
+    StringVector() = default;
+
+    // Room for `count` strings of `char_count` characters in total.
+    StringVector(std::size_t count, std::size_t char_count)
+        : chars(std::max<std::size_t>(char_count, 1)), entries(std::max<std::size_t>(count, 1))
+    {
+    }
+
+    StringVector(std::initializer_list<std::string_view> values)
+    {
+        append(values.begin(), values.end());
+    }
+
+    explicit StringVector(const Vector<std::string>& values)
+    {
+        std::size_t total = 0;
+        for (const std::string& value : values)
+        {
+            total += value.size();
+        }
+        reserve(values.size(), total);
+        append(values.begin(), values.end());
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return entries.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return entries.empty();
+    }
+
+    // Characters of the live strings.
+    [[nodiscard]] std::size_t char_count() const noexcept
+    {
+        return chars.size() - garbage;
+    }
+
+    // Characters left behind by erased or replaced strings, until the next compaction.
+    [[nodiscard]] std::size_t garbage_count() const noexcept
+    {
+        return garbage;
+    }
+
+    // Bytes held by both buffers, including spare capacity.
+    [[nodiscard]] std::size_t memory_bytes() const noexcept
+    {
+        return chars.capacity() + entries.capacity() * sizeof(Entry);
+    }
+
+    std::string_view operator[](std::size_t pos) const noexcept
+    {
+        const Entry& e = entry(pos);
+        return {std::as_const(chars).data() + e.offset, e.length};
+    }
+
+    std::string_view at(std::size_t pos) const
+    {
+        if (!(pos < size()))
+        {
+            throw std::out_of_range("Pos out of range");
+        }
+        return (*this)[pos];
+    }
+
+    std::string_view front() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    std::string_view back() const noexcept
+    {
+        return (*this)[size() - 1];
+    }
+
+    void reserve(std::size_t count, std::size_t char_count)
+    {
+        entries.reserve(count);
+        chars.reserve(char_count);
+    }
+
+    // `value` may view this vector's own characters.
+    void push_back(std::string_view value)
+    {
+        entries.push_back({chars.size(), value.size()});
+        try
+        {
+            append_chars(value);
+        }
+        catch (...)
+        {
+            entries.pop_back();
+            throw;
+        }
+    }
+
+    template <
+        class InputIt,
+        typename = std::enable_if_t<
+            std::is_convertible_v<typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>>>
+    void append(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            push_back(std::string_view(*first));
+        }
+    }
+
+    // Appends every element of `other` with one copy of its live characters.
+    void append(const StringVector& other)
+    {
+        if (other.garbage != 0)
+        {
+            StringVector packed = other;
+            packed.compact();
+            append(packed);
+            return;
+        }
+
+        const std::size_t base = chars.size();
+        const std::size_t first = size();
+        const Entry* source = std::as_const(other.entries).data();
+        const std::size_t count = other.size();
+        chars.append(std::as_const(other.chars).data(), std::as_const(other.chars).data() + other.chars.size());
+        entries.append(source, source + count);
+
+        Entry* added = entries.data() + first;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            added[i].offset += base;
+        }
+    }
+
+    void pop_back()
+    {
+        const Entry last = entry(size() - 1);
+        entries.pop_back();
+        if (last.offset + last.length == chars.size())
+        {
+            chars.resize(last.offset);
+        }
+        else
+        {
+            garbage += last.length;
+            compact_if_sparse();
+        }
+    }
+
+    // Replaces element `pos`. A value no longer than the old one is written in place; a longer one is appended.
+    // `value` may view this vector's own characters.
+    void assign(std::size_t pos, std::string_view value)
+    {
+        const Entry old = entry(pos);
+        if (value.size() <= old.length)
+        {
+            char* out = chars.data() + old.offset;
+            std::char_traits<char>::move(out, value.data(), value.size());
+            entries.data()[pos].length = value.size();
+            garbage += old.length - value.size();
+        }
+        else
+        {
+            const std::size_t offset = chars.size();
+            append_chars(value);
+            entries.data()[pos] = {offset, value.size()};
+            garbage += old.length;
+        }
+        compact_if_sparse();
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        const std::size_t begin = first.index;
+        const std::size_t end = last.index;
+        if (begin == end)
+        {
+            return first;
+        }
+
+        Entry* data = entries.data();
+        for (std::size_t i = begin; i < end; i++)
+        {
+            garbage += data[i].length;
+        }
+        std::copy(data + end, data + size(), data + begin);
+        entries.resize(size() - (end - begin));
+
+        compact_if_sparse();
+        return iterator(this, begin);
+    }
+
+    // Erases every element for which pred(std::string_view) is true, calling it once per element in order;
+    // returns how many.
+    template <typename Pred>
+    std::size_t erase_if(Pred pred)
+    {
+        const char* base = std::as_const(chars).data();
+        Entry* data = entries.data();
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < size(); i++)
+        {
+            if (pred(std::string_view(base + data[i].offset, data[i].length)))
+            {
+                garbage += data[i].length;
+            }
+            else
+            {
+                data[kept++] = data[i];
+            }
+        }
+
+        const std::size_t removed = size() - kept;
+        entries.resize(kept);
+        compact_if_sparse();
+        return removed;
+    }
+
+    void clear() noexcept
+    {
+        chars.clear();
+        entries.clear();
+        garbage = 0;
+    }
+
+    // Rewrites the characters in element order without garbage, into a buffer of exactly the live size.
+    void compact()
+    {
+        Vector<char> packed;
+        packed.overwrite(char_count(), [this](char* out) {
+            const char* source = std::as_const(chars).data();
+            Entry* data = entries.data();
+            std::size_t offset = 0;
+            for (std::size_t i = 0; i < size(); i++)
+            {
+                std::char_traits<char>::copy(out + offset, source + data[i].offset, data[i].length);
+                data[i].offset = offset;
+                offset += data[i].length;
+            }
+        });
+        chars.swap(packed);
+        garbage = 0;
+    }
+
+    void shrink_to_fit()
+    {
+        compact();
+        entries.shrink_to_fit();
+    }
+
+    void swap(StringVector& other) noexcept
+    {
+        chars.swap(other.chars);
+        entries.swap(other.entries);
+        std::swap(garbage, other.garbage);
+    }
+
+    [[nodiscard]] Vector<std::string> to_vector() const
+    {
+        Vector<std::string> result(std::max<std::size_t>(size(), 1));
+        for (const std::string_view value : *this)
+        {
+            result.emplace_back(value);
+        }
+        return result;
+    }
+
+    friend bool operator==(const StringVector& lhs, const StringVector& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return iterator(this, 0);
+    }
+    const_iterator end() const noexcept
+    {
+        return iterator(this, size());
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+};
+
+}  // namespace vector
@@ -0,0 +1,391 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <type_traits>
+
+// Tracing of the expensive moments in a Vector's life: growth and reserve reallocations, shrink_to_fit,
+// copy-on-write detaches and buffer destruction. Each one is timed and handed to a hook type chosen at compile
+// time, together with the sizes involved and the innermost trace::Site tag on the calling thread.
+//
+// trace::Hook<T>::type selects the hook for Vector<T>. It defaults to VECTOR_TRACE_HOOK, itself NoHook unless
+// defined, and NoHook compiles tracing out entirely. Specialize Hook for one element type to trace only that
+// type; define VECTOR_TRACE_HOOK to trace every type, identically in every translation unit, like
+// VECTOR_HARDENING_LEVEL. A hook is a type with a static record(const trace::Record&) noexcept, declared before
+// vector.hpp is included. HistogramSink is the built-in one.
+
+namespace vector::trace {
+
+enum class Event : std::uint8_t
+{
+    // The buffer was replaced to make room for a push or insert.
+    reallocate,
+    reserve,
+    shrink_to_fit,
+    // A write to a shared buffer copied it.
+    detach,
+    // The last owner released the buffer and its elements were destroyed.
+    destroy,
+};
+
+inline constexpr std::size_t event_count = 5;
+
+struct Record
+{
+    Event event;
+    // The Vector, or nullptr for destroy: a buffer outlives the particular copy that releases it.
+    const void* owner;
+    // The buffer before the event.
+    const void* buffer;
+    std::size_t element_size;
+    std::size_t size;
+    std::size_t old_capacity;
+    std::size_t new_capacity;
+    // Bytes copied or moved into a new buffer; 0 when the buffer grew in place.
+    std::size_t bytes_moved;
+    std::uint64_t nanoseconds;
+    // The innermost Site on the thread, or a default-constructed location when there is none.
+    std::source_location location;
+};
+
+struct NoHook
+{
+    static void record(const Record& /*record*/) noexcept
+    {
+    }
+};
+
+// Tags the events raised on this thread while it is alive with the place it was created:
+//     const vector::trace::Site site;
+// Sites nest; the innermost one wins.
+class Site
+{
+    std::source_location where;
+    const Site* outer;
+
+    static const Site*& innermost() noexcept
+    {
+        thread_local const Site* site = nullptr;
+        return site;
+    }
+
+   public:
+    explicit Site(std::source_location where = std::source_location::current()) noexcept
+        : where(where), outer(innermost())
+    {
+        innermost() = this;
+    }
+
+    Site(const Site&) = delete;
+    Site& operator=(const Site&) = delete;
+
+    ~Site()
+    {
+        innermost() = outer;
+    }
+
+    [[nodiscard]] static std::source_location current() noexcept
+    {
+        const Site* site = innermost();
+        return site != nullptr ? site->where : std::source_location();
+    }
+};
+
+// Power-of-two buckets of nanoseconds, safe to add to from any number of threads.
+class Histogram
+{
+   public:
+    static constexpr std::size_t bucket_count = 64;
+
+   private:
+    std::array<std::atomic<std::uint64_t>, bucket_count> buckets{};
+    std::atomic<std::uint64_t> total_ns = 0;
+    std::atomic<std::uint64_t> max_ns = 0;
+
+   public:
+    void add(std::uint64_t nanoseconds) noexcept
+    {
+        // The last bucket also takes everything from 2^62 up.
+        const auto bucket = std::min<std::size_t>(std::bit_width(nanoseconds), bucket_count - 1);
+        buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        total_ns.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+        std::uint64_t seen = max_ns.load(std::memory_order_relaxed);
+        while ((seen < nanoseconds) && !max_ns.compare_exchange_weak(seen, nanoseconds, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    [[nodiscard]] std::uint64_t count() const noexcept
+    {
+        std::uint64_t total = 0;
+        for (const auto& bucket : buckets)
+        {
+            total += bucket.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    [[nodiscard]] std::uint64_t sum() const noexcept
+    {
+        return total_ns.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t max() const noexcept
+    {
+        return max_ns.load(std::memory_order_relaxed);
+    }
+
+    // Upper bound of the bucket holding the q-quantile, q in [0, 1]; within a factor of two of the true value.
+    [[nodiscard]] std::uint64_t quantile(double q) const noexcept
+    {
+        const std::uint64_t total = count();
+        const auto rank = static_cast<std::uint64_t>(q * static_cast<double>(total));
+        std::uint64_t seen = 0;
+        for (std::size_t bucket = 0; bucket < bucket_count; bucket++)
+        {
+            seen += buckets[bucket].load(std::memory_order_relaxed);
+            if ((seen > rank) || (seen == total))
+            {
+                if (bucket == 0)
+                {
+                    return 0;
+                }
+                return bucket == bucket_count - 1 ? max() : std::min(max(), (std::uint64_t{1} << bucket) - 1);
+            }
+        }
+        return max();
+    }
+
+    // Not safe against concurrent add().
+    void reset() noexcept
+    {
+        for (auto& bucket : buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        total_ns.store(0, std::memory_order_relaxed);
+        max_ns.store(0, std::memory_order_relaxed);
+    }
+};
+
+struct SiteStats
+{
+    std::source_location location;
+    Event event;
+    std::uint64_t count;
+    std::uint64_t total_ns;
+    std::uint64_t max_ns;
+    std::uint64_t bytes_moved;
+};
+
+// Built-in hook: a latency histogram per event and totals per (Site, event), all in fixed static storage updated
+// with relaxed atomics, so recording never locks or allocates. The site table holds max_sites entries; events from
+// further sites only reach the histograms and are counted by dropped_sites().
+class HistogramSink
+{
+   public:
+    static constexpr std::size_t max_sites = 256;
+
+   private:
+    struct Slot
+    {
+        std::atomic<std::uint64_t> key = 0;
+        std::atomic<bool> ready = false;
+        std::source_location location;
+        Event event = Event::reallocate;
+        std::atomic<std::uint64_t> count = 0;
+        std::atomic<std::uint64_t> total_ns = 0;
+        std::atomic<std::uint64_t> max_ns = 0;
+        std::atomic<std::uint64_t> bytes_moved = 0;
+    };
+
+    struct State
+    {
+        std::array<Histogram, event_count> histograms;
+        std::array<Slot, max_sites> slots;
+        std::atomic<std::uint64_t> dropped = 0;
+        // Bumped by reset() so that threads drop their cached slots.
+        std::atomic<std::uint64_t> epoch = 1;
+    };
+
+    // Per-thread memo of recently used slots, keyed by the location's pointers, which saves hashing the file name
+    // on every event from a hot site.
+    struct CacheEntry
+    {
+        const char* file = nullptr;
+        std::uint_least32_t line = 0;
+        std::uint_least32_t column = 0;
+        Event event = Event::reallocate;
+        std::uint64_t epoch = 0;
+        Slot* slot = nullptr;
+    };
+
+    static State& state() noexcept
+    {
+        static State instance;
+        return instance;
+    }
+
+    // Hashes the location's text rather than its pointers, which differ between translation units for sites in
+    // inline functions. Never 0, which marks a free slot.
+    static std::uint64_t key_of(const std::source_location& location, Event event) noexcept
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+        const auto mix = [&hash](std::uint64_t value) {
+            hash ^= value;
+            hash *= 1099511628211ULL;
+        };
+        for (const char* c = location.file_name(); *c != '\0'; c++)
+        {
+            mix(static_cast<unsigned char>(*c));
+        }
+        mix(location.line());
+        mix(location.column());
+        mix(static_cast<std::uint64_t>(event));
+        return hash | 1;
+    }
+
+    static Slot* find_or_claim(const std::source_location& location, Event event) noexcept
+    {
+        const std::uint64_t key = key_of(location, event);
+        for (std::size_t probe = 0; probe < max_sites; probe++)
+        {
+            Slot& slot = state().slots[(key + probe) % max_sites];
+            std::uint64_t seen = slot.key.load(std::memory_order_acquire);
+            if ((seen == 0) && slot.key.compare_exchange_strong(seen, key, std::memory_order_acq_rel))
+            {
+                slot.location = location;
+                slot.event = event;
+                slot.ready.store(true, std::memory_order_release);
+                return &slot;
+            }
+            if (seen == key)
+            {
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    static Slot* cached_slot(const std::source_location& location, Event event) noexcept
+    {
+        thread_local std::array<CacheEntry, 16> cache;
+        const auto address = reinterpret_cast<std::uintptr_t>(location.file_name());
+        CacheEntry& entry = cache[(address ^ location.line() ^ static_cast<std::uintptr_t>(event)) % cache.size()];
+        const std::uint64_t epoch = state().epoch.load(std::memory_order_relaxed);
+        if ((entry.epoch == epoch) && (entry.file == location.file_name()) && (entry.line == location.line())
+            && (entry.column == location.column()) && (entry.event == event))
+        {
+            return entry.slot;
+        }
+
+        Slot* slot = find_or_claim(location, event);
+        if (slot != nullptr)
+        {
+            entry = {location.file_name(), location.line(), location.column(), event, epoch, slot};
+        }
+        return slot;
+    }
+
+   public:
+    static void record(const Record& record) noexcept
+    {
+        state().histograms[static_cast<std::size_t>(record.event)].add(record.nanoseconds);
+
+        Slot* slot = cached_slot(record.location, record.event);
+        if (slot == nullptr)
+        {
+            state().dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        slot->count.fetch_add(1, std::memory_order_relaxed);
+        slot->total_ns.fetch_add(record.nanoseconds, std::memory_order_relaxed);
+        slot->bytes_moved.fetch_add(record.bytes_moved, std::memory_order_relaxed);
+        std::uint64_t seen = slot->max_ns.load(std::memory_order_relaxed);
+        while ((seen < record.nanoseconds)
+               && !slot->max_ns.compare_exchange_weak(seen, record.nanoseconds, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    [[nodiscard]] static const Histogram& histogram(Event event) noexcept
+    {
+        return state().histograms[static_cast<std::size_t>(event)];
+    }
+
+    // Calls f(const SiteStats&) for every (Site, event) seen so far, in no particular order.
+    template <typename F>
+    static void for_each_site(F f)
+    {
+        for (const Slot& slot : state().slots)
+        {
+            if (slot.ready.load(std::memory_order_acquire))
+            {
+                f(SiteStats{
+                    slot.location,
+                    slot.event,
+                    slot.count.load(std::memory_order_relaxed),
+                    slot.total_ns.load(std::memory_order_relaxed),
+                    slot.max_ns.load(std::memory_order_relaxed),
+                    slot.bytes_moved.load(std::memory_order_relaxed)});
+            }
+        }
+    }
+
+    [[nodiscard]] static std::uint64_t dropped_sites() noexcept
+    {
+        return state().dropped.load(std::memory_order_relaxed);
+    }
+
+    // Clears everything. Not safe while other threads are recording.
+    static void reset() noexcept
+    {
+        for (Histogram& histogram : state().histograms)
+        {
+            histogram.reset();
+        }
+        for (Slot& slot : state().slots)
+        {
+            slot.ready.store(false, std::memory_order_relaxed);
+            slot.key.store(0, std::memory_order_relaxed);
+            slot.count.store(0, std::memory_order_relaxed);
+            slot.total_ns.store(0, std::memory_order_relaxed);
+            slot.max_ns.store(0, std::memory_order_relaxed);
+            slot.bytes_moved.store(0, std::memory_order_relaxed);
+        }
+        state().dropped.store(0, std::memory_order_relaxed);
+        state().epoch.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+}  // namespace vector::trace
+
+#ifndef VECTOR_TRACE_HOOK
+#define VECTOR_TRACE_HOOK ::vector::trace::NoHook
+#endif
+
+namespace vector::trace {
+
+template <typename T>
+struct Hook
+{
+    using type = VECTOR_TRACE_HOOK;
+};
+
+template <typename T>
+inline constexpr bool enabled = !std::is_same_v<typename Hook<T>::type, NoHook>;
+
+[[nodiscard]] inline std::uint64_t nanoseconds_since(std::chrono::steady_clock::time_point start) noexcept
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+}  // namespace vector::trace
@@ -3,6 +3,14 @@
 #include <utility>
 #include <stdexcept>
 #include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <vector/arena.hpp>
+#include <vector/hardening.hpp>
+#include <vector/storage_pool.hpp>
+#include <vector/tracing.hpp>
 
 namespace vector {
 
@@ -13,34 +21,176 @@ struct VecStorage
 {
     std::size_t size = 0;
     std::size_t capacity = 1;
+    Arena* arena = nullptr;
+    bool pooled = false;
     T* data;
+#if VECTOR_ANNOTATE_CONTAINER
+    std::size_t annotated = capacity;
+#endif
 
-    constexpr VecStorage() : data(static_cast<T*>(operator new(sizeof(T))))
+    static constexpr bool use_pool(Arena* arena) noexcept
     {
+        if (std::is_constant_evaluated())
+        {
+            return false;
+        }
+        return (arena == nullptr) && (alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) && StoragePool::enabled();
     }
 
-    constexpr explicit VecStorage(std::size_t new_capacity)
-        : capacity(new_capacity), data(static_cast<T*>(operator new(sizeof(T) * new_capacity)))
+    constexpr T* allocate(std::size_t count) const
     {
+        if (std::is_constant_evaluated())
+        {
+            return std::allocator<T>{}.allocate(count);
+        }
+        if (arena != nullptr)
+        {
+            return static_cast<T*>(arena->allocate(sizeof(T) * count, alignof(T)));
+        }
+        if (pooled)
+        {
+            return static_cast<T*>(StoragePool::allocate(sizeof(T) * count));
+        }
+        return static_cast<T*>(operator new(sizeof(T) * count));
     }
 
-    constexpr ~VecStorage()
+    constexpr void deallocate() noexcept
+    {
+        if (std::is_constant_evaluated())
+        {
+            if (data != nullptr)
+            {
+                std::allocator<T>{}.deallocate(data, capacity);
+            }
+        }
+        else if (arena != nullptr)
+        {
+            arena->deallocate(data, sizeof(T) * capacity);
+        }
+        else if (pooled)
+        {
+            StoragePool::deallocate(data, sizeof(T) * capacity);
+        }
+        else
+        {
+            operator delete(data);
+        }
+    }
+
+    // Tells AddressSanitizer that [data + mid, data + capacity) is not addressable. Fresh buffers start out
+    // fully addressable; Vector poisons the slack past size between mutations.
+    constexpr void annotate(std::size_t mid) noexcept
+    {
+#if VECTOR_ANNOTATE_CONTAINER
+        if (!std::is_constant_evaluated())
+        {
+            hardening::annotate(data, data + capacity, data + annotated, data + mid);
+        }
+        annotated = mid;
+#else
+        static_cast<void>(mid);
+#endif
+    }
+
+    constexpr void poison_tail() noexcept
+    {
+        annotate(size);
+    }
+
+    constexpr void unpoison() noexcept
+    {
+        annotate(capacity);
+    }
+
+    constexpr VecStorage() : pooled(use_pool(nullptr)), data(allocate(1))
+    {
+    }
+
+    constexpr explicit VecStorage(std::size_t new_capacity, Arena* arena = nullptr)
+        : capacity(new_capacity), arena(arena), pooled(use_pool(arena)), data(allocate(new_capacity))
+    {
+    }
+
+    constexpr void release() noexcept
     {
         std::destroy_n(data, size);
-        operator delete(data);
+        unpoison();
+        deallocate();
+    }
+
+    constexpr ~VecStorage()
+    {
+        if constexpr (trace::enabled<T>)
+        {
+            if (!std::is_constant_evaluated() && (data != nullptr))
+            {
+                trace::Record record{.event = trace::Event::destroy, .owner = nullptr, .buffer = data,
+                                     .element_size = sizeof(T), .size = size, .old_capacity = capacity,
+                                     .new_capacity = 0, .bytes_moved = 0, .nanoseconds = 0,
+                                     .location = trace::Site::current()};
+                const auto start = std::chrono::steady_clock::now();
+                release();
+                record.nanoseconds = trace::nanoseconds_since(start);
+                trace::Hook<T>::type::record(record);
+                return;
+            }
+        }
+        release();
+    }
+
+    constexpr bool try_expand(std::size_t new_capacity) noexcept
+    {
+        if ((arena == nullptr) || !arena->try_expand(data, sizeof(T) * capacity, sizeof(T) * new_capacity))
+        {
+            return false;
+        }
+
+        unpoison();
+        capacity = new_capacity;
+#if VECTOR_ANNOTATE_CONTAINER
+        annotated = new_capacity;
+#endif
+        return true;
     }
 
     constexpr void swap(VecStorage<T>& other) noexcept
     {
         std::swap(size, other.size);
         std::swap(capacity, other.capacity);
+        std::swap(arena, other.arena);
+        std::swap(pooled, other.pooled);
         std::swap(data, other.data);
+#if VECTOR_ANNOTATE_CONTAINER
+        std::swap(annotated, other.annotated);
+#endif
     }
 
     constexpr VecStorage(const VecStorage<T>& copy)
-        : size(copy.size), capacity(copy.capacity), data(static_cast<T*>(operator new(sizeof(T) * copy.capacity)))
+        : size(copy.size),
+          capacity(copy.capacity),
+          arena(copy.arena),
+          pooled(use_pool(copy.arena)),
+          data(allocate(copy.capacity))
     {
-        std::uninitialized_copy_n(copy.data, copy.size, data);
+        if (std::is_constant_evaluated())
+        {
+            for (std::size_t i = 0; i < size; i++)
+            {
+                std::construct_at(data + i, copy.data[i]);
+            }
+        }
+        else
+        {
+            try
+            {
+                std::uninitialized_copy_n(copy.data, copy.size, data);
+            }
+            catch (...)
+            {
+                deallocate();
+                throw;
+            }
+        }
     }
 
     constexpr VecStorage& operator=(VecStorage<T> other) noexcept
@@ -52,8 +202,13 @@ struct VecStorage
     constexpr VecStorage(VecStorage<T>&& other) noexcept
         : size(std::exchange(other.size, 0)),
           capacity(std::exchange(other.capacity, 0)),
+          arena(other.arena),
+          pooled(other.pooled),
           data(std::exchange(other.data, nullptr))
     {
+#if VECTOR_ANNOTATE_CONTAINER
+        annotated = std::exchange(other.annotated, 0);
+#endif
     }
 };
 
@@ -61,51 +216,361 @@ template <typename T>
 class Vector
 {
     std::shared_ptr<VecStorage<T>> storage;
+#if VECTOR_HARDENING_LEVEL >= 2
+    std::size_t generation = 0;
+#endif
+#if VECTOR_ANNOTATE_CONTAINER
+    std::size_t annotation_depth = 0;
+#endif
+
+    // Keeps the slack of a uniquely owned buffer addressable while a mutator runs and poisons it again when the
+    // outermost mutator returns. Shared buffers are never written past their size, so they stay poisoned.
+    class MutationScope
+    {
+#if VECTOR_ANNOTATE_CONTAINER
+        Vector* owner;
+
+       public:
+        explicit MutationScope(Vector& owner) noexcept : owner(&owner)
+        {
+            if ((owner.annotation_depth++ == 0) && (owner.storage.use_count() == 1))
+            {
+                owner.storage->unpoison();
+            }
+        }
+
+        MutationScope(const MutationScope&) = delete;
+        MutationScope& operator=(const MutationScope&) = delete;
+
+        ~MutationScope()
+        {
+            if ((--owner->annotation_depth == 0) && owner->storage)
+            {
+                owner->storage->poison_tail();
+            }
+        }
+#else
+       public:
+        explicit MutationScope(Vector& /*owner*/) noexcept
+        {
+        }
+#endif
+    };
+
+    constexpr void invalidate_iterators() noexcept
+    {
+#if VECTOR_HARDENING_LEVEL >= 2
+        ++generation;
+#endif
+    }
+
+    template <typename... Args>
+    static std::shared_ptr<VecStorage<T>> make_storage(Arena* arena, Args&&... args)
+    {
+        if (arena != nullptr)
+        {
+            return std::allocate_shared<VecStorage<T>>(
+                ArenaAllocator<VecStorage<T>>(*arena), std::forward<Args>(args)...);
+        }
+        return std::make_shared<VecStorage<T>>(std::forward<Args>(args)...);
+    }
+
+    explicit Vector(std::shared_ptr<VecStorage<T>> new_storage) : storage(std::move(new_storage))
+    {
+    }
+
+    // Runs `body`, which may replace the buffer, and reports it to the element type's trace hook.
+    template <typename Body>
+    constexpr void traced(trace::Event event, Body body)
+    {
+        if constexpr (trace::enabled<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const T* buffer = storage->data;
+                const std::size_t old_size = size();
+                const std::size_t old_capacity = capacity();
+                const auto start = std::chrono::steady_clock::now();
+                body();
+                const std::uint64_t nanoseconds = trace::nanoseconds_since(start);
+                trace::Hook<T>::type::record({.event = event, .owner = this, .buffer = buffer,
+                                              .element_size = sizeof(T), .size = size(),
+                                              .old_capacity = old_capacity, .new_capacity = capacity(),
+                                              .bytes_moved = storage->data == buffer ? 0 : old_size * sizeof(T),
+                                              .nanoseconds = nanoseconds, .location = trace::Site::current()});
+                return;
+            }
+        }
+        body();
+    }
 
     void copy_storage()
     {
         if (storage.use_count() != 1)
         {
-            storage.reset(new VecStorage<T>(*storage.get()));
+            const MutationScope scope(*this);
+            traced(trace::Event::detach, [this] { storage = make_storage(storage->arena, *storage); });
+        }
+    }
+
+    template <typename It>
+    static constexpr bool is_forward_iterator
+        = std::is_convertible_v<typename std::iterator_traits<It>::iterator_category, std::forward_iterator_tag>;
+
+    // Shifting elements in place only uses moves; when those cannot throw, an insert that does not reallocate
+    // can keep the strong guarantee by constructing the new elements first.
+    static constexpr bool nothrow_shift
+        = std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>;
+
+    static constexpr bool nothrow_copy
+        = std::is_nothrow_copy_constructible_v<T> && std::is_nothrow_copy_assignable_v<T>;
+
+    [[nodiscard]] constexpr std::size_t next_capacity(std::size_t count) const noexcept
+    {
+        return std::max(size() + count, capacity() * vector::factor);
+    }
+
+    constexpr void destroy_tail(std::size_t new_size) noexcept
+    {
+        std::destroy(storage->data + new_size, storage->data + size());
+        storage->size = new_size;
+    }
+
+    // Constructs copies of elements [first, last) in raw memory at `out`, moving them instead when that cannot
+    // throw (or T is move-only) and the buffer is not shared. Cleans up after itself on exception.
+    constexpr void relocate(std::size_t first, std::size_t last, T* out)
+    {
+        T* begin = storage->data + first;
+        T* end = storage->data + last;
+
+        if constexpr (std::is_copy_constructible_v<T>)
+        {
+            if (!std::is_nothrow_move_constructible_v<T> || (storage.use_count() != 1))
+            {
+                std::uninitialized_copy(begin, end, out);
+                return;
+            }
+        }
+        std::uninitialized_move(begin, end, out);
+    }
+
+    // Builds the result of inserting `count` elements at `index` in a new buffer and swaps it in. The new
+    // elements are constructed first, so they may be copied from elements of this vector. Strong guarantee.
+    template <typename Construct>
+    constexpr void rebuild_with_gap(std::size_t index, std::size_t count, Construct construct)
+    {
+        traced(trace::Event::reallocate, [&] {
+            const std::size_t new_capacity = (size() + count > capacity()) ? next_capacity(count) : capacity();
+            Vector<T> tmp_buf(make_storage(storage->arena, new_capacity, storage->arena));
+            VecStorage<T>& dst = *tmp_buf.storage;
+
+            construct(dst.data + index);
+            try
+            {
+                relocate(0, index, dst.data);
+            }
+            catch (...)
+            {
+                std::destroy_n(dst.data + index, count);
+                throw;
+            }
+            dst.size = index + count;
+
+            relocate(index, size(), dst.data + index + count);
+            dst.size = size() + count;
+
+            invalidate_iterators();
+            tmp_buf.swap(*this);
+        });
+    }
+
+    // Appends `count` elements built by `construct(place)`, which must clean up after itself on exception.
+    // Strong guarantee.
+    template <typename Construct>
+    constexpr void append_with(std::size_t count, Construct construct)
+    {
+        const MutationScope scope(*this);
+
+        if (size() + count > capacity())
+        {
+            if ((storage.use_count() != 1) || !storage->try_expand(next_capacity(count)))
+            {
+                rebuild_with_gap(size(), count, construct);
+                return;
+            }
+            invalidate_iterators();
+        }
+        else
+        {
+            copy_storage();
+        }
+
+        construct(storage->data + size());
+        storage->size += count;
+    }
+
+    // Inserts `count` elements at `index`. Reallocations, and inserts into the middle of types whose moves may
+    // throw, go through rebuild_with_gap. Otherwise the elements are constructed past the end and rotated into
+    // place, or moved there directly by `shift` when Shift is set, which needs copies that cannot throw.
+    // Strong guarantee.
+    template <bool Shift, typename Construct, typename ShiftInPlace>
+    constexpr void insert_with(std::size_t index, std::size_t count, Construct construct, ShiftInPlace shift)
+    {
+        const MutationScope scope(*this);
+        invalidate_iterators();
+
+        if ((size() + count > capacity()) || (!nothrow_shift && (index != size())))
+        {
+            rebuild_with_gap(index, count, construct);
+            return;
         }
+
+        copy_storage();
+
+        if constexpr (Shift)
+        {
+            if (index != size())
+            {
+                shift();
+                return;
+            }
+        }
+
+        const std::size_t old_size = size();
+        construct(storage->data + old_size);
+        storage->size += count;
+        std::rotate(storage->data + index, storage->data + old_size, storage->data + size());
     }
 
-    void push_back_internal(const T& value)
+    template <typename ForwardIt>
+    constexpr void insert_uninitialized(std::size_t index, std::size_t count, ForwardIt first, ForwardIt last)
     {
-        new (storage->data + storage->size) T(value);
-        ++storage->size;
+        T* base = storage->data;
+        const std::size_t old_size = size();
+        const std::size_t tail = old_size - index;
+
+        if (tail > count)
+        {
+            std::uninitialized_move(base + old_size - count, base + old_size, base + old_size);
+            storage->size += count;
+            std::move_backward(base + index, base + old_size - count, base + old_size);
+            std::copy(first, last, base + index);
+        }
+        else
+        {
+            ForwardIt mid = first;
+            std::advance(mid, tail);
+            std::uninitialized_copy(mid, last, base + old_size);
+            storage->size += count - tail;
+            std::uninitialized_move(base + index, base + old_size, base + index + count);
+            storage->size += tail;
+            std::copy(first, mid, base + index);
+        }
     }
 
-    void move_back_internal(T&& value)
+    constexpr void insert_value(std::size_t index, T&& value)
     {
-        new (storage->data + storage->size) T(std::move(value));
-        ++storage->size;
+        insert_with<true>(
+            index,
+            1,
+            [&value](T* place) { new (place) T(std::move(value)); },
+            [this, index, &value] {
+                T* base = storage->data;
+                const std::size_t old_size = size();
+
+                new (base + old_size) T(std::move(base[old_size - 1]));
+                ++storage->size;
+                std::move_backward(base + index, base + old_size - 1, base + old_size);
+                base[index] = std::move(value);
+            });
     }
 
-    template <typename X>
-    typename std::enable_if<!std::is_nothrow_move_constructible<X>::value>::type simple_copy(Vector<T>& dst)
+    constexpr void insert_fill(std::size_t index, std::size_t count, const T& value)
     {
-        std::for_each(storage->data, storage->data + storage->size, [&dst](T const& v) { dst.push_back_internal(v); });
+        T* base = storage->data;
+        const std::size_t old_size = size();
+        const std::size_t tail = old_size - index;
+
+        if (tail > count)
+        {
+            std::uninitialized_move(base + old_size - count, base + old_size, base + old_size);
+            storage->size += count;
+            std::move_backward(base + index, base + old_size - count, base + old_size);
+            std::fill_n(base + index, count, value);
+        }
+        else
+        {
+            std::uninitialized_fill_n(base + old_size, count - tail, value);
+            storage->size += count - tail;
+            std::uninitialized_move(base + index, base + old_size, base + index + count);
+            storage->size += tail;
+            std::fill_n(base + index, tail, value);
+        }
     }
 
-    template <typename X>
-    typename std::enable_if<std::is_nothrow_move_constructible<X>::value>::type simple_copy(Vector<T>& dst)
+    template <typename Construct>
+    constexpr void resize_with(std::size_t count, Construct construct)
     {
-        std::for_each(
-            storage->data, storage->data + storage->size, [&dst](T& v) { dst.move_back_internal(std::move(v)); });
+        if (count < size())
+        {
+            const MutationScope scope(*this);
+            invalidate_iterators();
+            copy_storage();
+            destroy_tail(count);
+        }
+        else if (count > size())
+        {
+            const std::size_t extra = count - size();
+            append_with(extra, [&construct, extra](T* place) { construct(place, extra); });
+        }
     }
 
    public:
     constexpr Vector() : storage(std::make_shared<VecStorage<T>>())
     {
+        storage->poison_tail();
+    }
+
+    constexpr explicit Vector(std::size_t capacity) : storage(make_storage(nullptr, capacity))
+    {
+        storage->poison_tail();
+    }
+
+    explicit Vector(Arena& arena) : storage(make_storage(&arena, 1, &arena))
+    {
+        storage->poison_tail();
+    }
+
+    Vector(std::size_t capacity, Arena& arena) : storage(make_storage(&arena, capacity, &arena))
+    {
+        storage->poison_tail();
+    }
+
+    // Evaluates an elementwise expression (see expression.hpp) straight into this vector's storage.
+    template <typename Expr>
+        requires requires(const Expr& expr, Vector<T>& vec) { expr.evaluate_into(vec); }
+    Vector(const Expr& expr) : Vector(std::max<std::size_t>(expr.size(), 1))
+    {
+        expr.evaluate_into(*this);
+    }
+
+    template <typename Expr>
+        requires requires(const Expr& expr, Vector<T>& vec) { expr.evaluate_into(vec); }
+    Vector& operator=(const Expr& expr)
+    {
+        expr.evaluate_into(*this);
+        return *this;
     }
 
-    constexpr explicit Vector(std::size_t capacity) : storage(std::make_shared<VecStorage<T>>(VecStorage<T>{capacity}))
+    [[nodiscard]] Arena* arena() const noexcept
     {
+        return storage->arena;
     }
 
     constexpr void clear() noexcept
     {
+        const MutationScope scope(*this);
+        invalidate_iterators();
         copy_storage();
         std::destroy_n(storage->data, size());
         storage->size = 0;
@@ -153,22 +618,48 @@ class Vector
 
     constexpr const T& operator[](std::size_t pos) const
     {
+        VECTOR_HARDENING_ASSERT(pos < size(), "operator[] index out of range");
         return storage->data[pos];
     }
 
     constexpr T& operator[](std::size_t pos)
     {
+        VECTOR_HARDENING_ASSERT(pos < size(), "operator[] index out of range");
         copy_storage();
         return storage->data[pos];
     }
 
+    [[nodiscard]] constexpr const T* data() const noexcept
+    {
+        return storage->data;
+    }
+
+    constexpr T* data()
+    {
+        copy_storage();
+        return storage->data;
+    }
+
+    // Strong guarantee: if copying an element throws, the vector is left unchanged. Elements are moved only when
+    // their move constructor is noexcept (or T is move-only) and the buffer is not shared.
     constexpr void reserve(std::size_t new_capacity)
     {
         if (new_capacity > capacity())
         {
-            Vector<T> tmp_buf(new_capacity);
-            simple_copy<T>(tmp_buf);
-            tmp_buf.swap(*this);
+            const MutationScope scope(*this);
+            invalidate_iterators();
+
+            traced(trace::Event::reserve, [this, new_capacity] {
+                if ((storage.use_count() == 1) && storage->try_expand(new_capacity))
+                {
+                    return;
+                }
+
+                Vector<T> tmp_buf(make_storage(storage->arena, new_capacity, storage->arena));
+                relocate(0, size(), tmp_buf.storage->data);
+                tmp_buf.storage->size = size();
+                tmp_buf.swap(*this);
+            });
         }
     }
 
@@ -179,96 +670,107 @@ class Vector
             return;
         }
 
-        Vector<T> tmp_buf(size());
-        simple_copy<T>(tmp_buf);
-        tmp_buf.swap(*this);
+        const MutationScope scope(*this);
+        invalidate_iterators();
+
+        traced(trace::Event::shrink_to_fit, [this] {
+            Vector<T> tmp_buf(make_storage(storage->arena, size(), storage->arena));
+            relocate(0, size(), tmp_buf.storage->data);
+            tmp_buf.storage->size = size();
+            tmp_buf.swap(*this);
+        });
     }
 
-    constexpr void push_back(const T& value)
+    // Strong guarantee; the arguments may refer to elements of this vector.
+    template <typename... Args>
+    constexpr T& emplace_back(Args&&... args)
     {
-        copy_storage();
-
-        if (size() == capacity())
-        {
-            reserve(storage->capacity * vector::factor);
-        }
+        append_with(1, [&args...](T* place) { new (place) T(std::forward<Args>(args)...); });
+        return storage->data[size() - 1];
+    }
 
-        push_back_internal(value);
+    constexpr void push_back(const T& value)
+    {
+        emplace_back(value);
     }
 
     constexpr void push_back(T&& value)
     {
-        copy_storage();
-
-        if (size() == capacity())
-        {
-            reserve(storage->capacity * vector::factor);
-        }
-
-        move_back_internal(std::move(value));
+        emplace_back(std::move(value));
     }
 
     constexpr void pop_back()
     {
+        VECTOR_HARDENING_ASSERT(!empty(), "pop_back on empty vector");
+        const MutationScope scope(*this);
         copy_storage();
         --storage->size;
         std::destroy_at(&storage->data[size()]);
     }
 
+    // Strong guarantee when growing.
     constexpr void resize(std::size_t count)
     {
-        if (count == size())
-        {
-            return;
-        }
-
-        copy_storage();
-
-        if (count < size())
-        {
-            std::destroy_n(storage->data + count, size() - 1 - count);
-        }
-        if (count >= capacity())
-        {
-            reserve(count * vector::factor);
-        }
-        if (count > size())
-        {
-            std::uninitialized_value_construct_n(storage->data + size(), count - size());
-        }
-
-        storage->size = count;
+        resize_with(count, [](T* place, std::size_t extra) { std::uninitialized_value_construct_n(place, extra); });
     }
 
     constexpr void resize(std::size_t count, const T& value)
     {
-        if (count == size())
-        {
-            return;
-        }
+        resize_with(count, [&value](T* place, std::size_t extra) { std::uninitialized_fill_n(place, extra, value); });
+    }
 
-        copy_storage();
+    // Replaces the contents with `count` elements that `write(out)` stores to out[0, count). The buffer is reused
+    // when it is uniquely owned and large enough; otherwise `write` fills a new one and the old contents, which
+    // are never copied, stay readable until it returns. Basic guarantee.
+    template <typename Write>
+        requires std::is_trivial_v<T>
+    constexpr void overwrite(std::size_t count, Write write)
+    {
+        const MutationScope scope(*this);
+        invalidate_iterators();
 
-        if (count < size())
+        if ((storage.use_count() == 1) && ((count <= capacity()) || storage->try_expand(count)))
         {
-            std::destroy_n(storage->data + count, size() - 1 - count);
-        }
-        if (count >= capacity())
-        {
-            reserve(count * vector::factor);
-        }
-        if (count > size())
-        {
-            std::uninitialized_fill_n(storage->data + size(), count - size(), value);
+            write(storage->data);
+            storage->size = count;
+            return;
         }
 
-        storage->size = count;
+        Vector<T> tmp_buf(make_storage(storage->arena, std::max<std::size_t>(count, 1), storage->arena));
+        write(tmp_buf.storage->data);
+        tmp_buf.storage->size = count;
+        tmp_buf.swap(*this);
     }
 
     class Iterator
     {
         Vector<T>* vector;
         std::size_t index;
+#if VECTOR_HARDENING_LEVEL >= 2
+        std::size_t generation;
+#endif
+
+        friend class Vector;
+
+        Vector<T>& owner() const
+        {
+#if VECTOR_HARDENING_LEVEL >= 2
+            VECTOR_HARDENING_ASSERT(generation == vector->generation, "iterator used after the vector was modified");
+#endif
+            return *vector;
+        }
+
+        // Position of an iterator passed back into a mutator of `expected`.
+        [[nodiscard]] std::size_t index_in(const Vector<T>* expected) const
+        {
+#if VECTOR_HARDENING_LEVEL >= 2
+            VECTOR_HARDENING_ASSERT(vector == expected, "iterator belongs to a different vector");
+            VECTOR_HARDENING_ASSERT(generation == expected->generation, "iterator used after the vector was modified");
+#else
+            static_cast<void>(expected);
+#endif
+            return index;
+        }
 
        public:
         using value_type = T;
@@ -281,35 +783,41 @@ class Vector
 
         Iterator() : vector(nullptr), index(0)
         {
+#if VECTOR_HARDENING_LEVEL >= 2
+            generation = 0;
+#endif
         }
 
         Iterator(Vector<T>* vector, std::size_t new_index) : vector(vector), index(new_index)
         {
+#if VECTOR_HARDENING_LEVEL >= 2
+            generation = vector->generation;
+#endif
         }
 
         reference operator*()
         {
-            return vector->at(index);
+            return owner().at(index);
         }
         const_reference operator*() const
         {
-            return vector->at(index);
+            return owner().at(index);
         }
         pointer operator->()
         {
-            return &(vector->at(index));
+            return &(owner().at(index));
         }
         const_pointer operator->() const
         {
-            return &(vector->at(index));
+            return &(owner().at(index));
         }
         reference operator[](std::size_t offset)
         {
-            return vector->at(index + offset);
+            return owner().at(index + offset);
         }
         const_reference operator[](std::size_t offset) const
         {
-            return vector->at(index + offset);
+            return owner().at(index + offset);
         }
 
         Iterator& operator++()
@@ -408,110 +916,194 @@ class Vector
             return end();
         }
 
+        const std::size_t index = pos.index_in(this);
+        VECTOR_HARDENING_ASSERT(index < size(), "erase position out of range");
+
+        const MutationScope scope(*this);
+        invalidate_iterators();
         copy_storage();
 
-        std::move(pos + 1, end(), pos);
-        --storage->size;
-        return iterator(pos);
+        std::move(storage->data + index + 1, storage->data + size(), storage->data + index);
+        destroy_tail(size() - 1);
+        return iterator(this, index);
     }
 
     constexpr iterator erase(const_iterator first, const_iterator last)
     {
+        const std::size_t index = first.index_in(this);
+        const std::size_t end_index = last.index_in(this);
+        VECTOR_HARDENING_ASSERT((index <= end_index) && (end_index <= size()), "erase range out of range");
+
         if (empty() || (last - first <= 0))
         {
             return end();
         }
 
+        const std::size_t count = end_index - index;
+
+        const MutationScope scope(*this);
+        invalidate_iterators();
         copy_storage();
 
-        std::move(last, end(), first);
-        storage->size -= last - first;
-        return iterator(first);
+        std::move(storage->data + index + count, storage->data + size(), storage->data + index);
+        destroy_tail(size() - count);
+        return iterator(this, index);
     }
 
-    constexpr iterator insert(const_iterator pos, const T& value)
+    template <typename Pred>
+    constexpr std::size_t erase_if(Pred pred)
     {
-        copy_storage();
+        const T* shared = std::as_const(*this).data();
+        const auto first = static_cast<std::size_t>(std::find_if(shared, shared + size(), pred) - shared);
 
-        if (size() == capacity())
+        if (first == size())
         {
-            reserve(storage->capacity * vector::factor);
+            return 0;
         }
 
-        if (pos == end())
-        {
-            push_back_internal(value);
-        }
-        else
-        {
-            ++storage->size;
-            if (!std::is_trivially_move_assignable<T>::value)
-            {
-                std::uninitialized_default_construct_n(end() - 1, 1);
-            }
-            std::move_backward(pos, end() - 1, end());
-            storage->data[pos - begin()] = value;
-        }
+        const MutationScope scope(*this);
+        invalidate_iterators();
+        copy_storage();
 
-        return iterator(pos);
+        T* base = storage->data;
+        T* new_end = std::remove_if(base + first, base + size(), pred);
+        const std::size_t removed = size() - static_cast<std::size_t>(new_end - base);
+        destroy_tail(size() - removed);
+        return removed;
     }
 
-    constexpr iterator insert(const_iterator pos, T&& value)
+    constexpr iterator swap_remove(const_iterator pos)
     {
+        if (empty())
+        {
+            return end();
+        }
+
+        const std::size_t index = pos.index_in(this);
+        VECTOR_HARDENING_ASSERT(index < size(), "swap_remove position out of range");
+
+        const MutationScope scope(*this);
+        invalidate_iterators();
         copy_storage();
 
-        if (size() == capacity())
+        if (index != size() - 1)
         {
-            reserve(storage->capacity * vector::factor);
+            storage->data[index] = std::move(storage->data[size() - 1]);
         }
+        destroy_tail(size() - 1);
+        return iterator(this, index);
+    }
 
-        if (pos == end())
+    // Erases the elements at `indices`, which must be sorted in ascending order; duplicates are allowed. Returns
+    // how many elements were removed. Throws std::out_of_range, leaving the vector unchanged, if an index is past
+    // the end.
+    constexpr std::size_t erase_indices(std::span<const std::size_t> indices)
+    {
+        if (indices.empty())
         {
-            move_back_internal(std::move(value));
+            return 0;
         }
-        else
+        VECTOR_HARDENING_ASSERT(std::is_sorted(indices.begin(), indices.end()), "erase_indices indices not sorted");
+        if (!(indices.front() < size()) || !(indices.back() < size()))
         {
-            ++storage->size;
-            if (!std::is_trivially_move_assignable<T>::value)
+            throw std::out_of_range("Index out of range");
+        }
+
+        const MutationScope scope(*this);
+        invalidate_iterators();
+        copy_storage();
+
+        T* base = storage->data;
+        std::size_t write = indices.front();
+
+        for (std::size_t i = 0; i < indices.size(); i++)
+        {
+            const std::size_t from = indices[i] + 1;
+            const std::size_t to = (i + 1 < indices.size()) ? indices[i + 1] : size();
+
+            if (from < to)
             {
-                std::uninitialized_default_construct_n(end() - 1, 1);
+                write = static_cast<std::size_t>(std::move(base + from, base + to, base + write) - base);
             }
-            std::move_backward(pos, end() - 1, end());
-            storage->data[pos - begin()] = std::move(value);
         }
 
-        return iterator(pos);
+        const std::size_t removed = size() - write;
+        destroy_tail(write);
+        return removed;
+    }
+
+    // Every insert has the strong guarantee, provided the iterator operations themselves do not throw.
+    constexpr iterator insert(const_iterator pos, const T& value)
+    {
+        const std::size_t index = pos.index_in(this);
+        VECTOR_HARDENING_ASSERT(index <= size(), "insert position out of range");
+
+        T copy(value);
+        insert_value(index, std::move(copy));
+        return iterator(this, index);
+    }
+
+    constexpr iterator insert(const_iterator pos, T&& value)
+    {
+        const std::size_t index = pos.index_in(this);
+        VECTOR_HARDENING_ASSERT(index <= size(), "insert position out of range");
+
+        insert_value(index, std::move(value));
+        return iterator(this, index);
     }
 
     constexpr iterator insert(const_iterator pos, std::size_t count, const T& value)
     {
+        const std::size_t index = pos.index_in(this);
+        VECTOR_HARDENING_ASSERT(index <= size(), "insert position out of range");
+
         if (count != 0)
         {
-            copy_storage();
+            const T copy(value);
 
-            if (size() + count >= capacity())
-            {
-                reserve((size() + count) * vector::factor);
-            }
+            insert_with<nothrow_copy>(
+                index,
+                count,
+                [count, &copy](T* place) { std::uninitialized_fill_n(place, count, copy); },
+                [this, index, count, &copy] { insert_fill(index, count, copy); });
+        }
+
+        return iterator(this, index);
+    }
 
-            if (pos == end())
+    // Strong guarantee for forward iterators; with input iterators the elements read before an exception stay
+    // appended.
+    template <
+        class InputIt,
+        typename = std::enable_if_t<
+            std::is_convertible_v<typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>>>
+    constexpr void append(InputIt first, InputIt last)
+    {
+        if constexpr (std::is_same_v<InputIt, Iterator>)
+        {
+            insert(cend(), first, last);
+        }
+        else if constexpr (is_forward_iterator<InputIt>)
+        {
+            const auto count = static_cast<std::size_t>(std::distance(first, last));
+
+            if (count != 0)
             {
-                storage->size += count;
-                std::uninitialized_fill_n(pos, count, value);
+                append_with(count, [&first, &last](T* place) { std::uninitialized_copy(first, last, place); });
             }
-            else
+        }
+        else
+        {
+            for (; first != last; ++first)
             {
-                storage->size += count;
-                if (!std::is_trivially_move_assignable<T>::value)
-                {
-                    std::uninitialized_default_construct_n(end() - count, count);
-                }
-                std::move_backward(pos, end() - count, end());
-                std::fill_n(pos, count, value);
+                emplace_back(*first);
             }
         }
+    }
 
-        return iterator(pos);
+    constexpr void append(std::initializer_list<T> values)
+    {
+        append(values.begin(), values.end());
     }
 
     template <
@@ -520,36 +1112,79 @@ class Vector
             std::is_convertible_v<typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>>>
     constexpr iterator insert(const_iterator pos, InputIt first, InputIt last)
     {
-        std::size_t count = last - first;
+        const std::size_t index = pos.index_in(this);
+        VECTOR_HARDENING_ASSERT(index <= size(), "insert position out of range");
 
-        if (count != 0)
+        if constexpr (std::is_same_v<InputIt, Iterator>)
         {
-            copy_storage();
+            const T* source = std::as_const(first.owner()).data();
+            VECTOR_HARDENING_ASSERT(last.index <= first.vector->size(), "insert source range out of range");
 
-            if (size() + count >= capacity())
-            {
-                reserve((size() + count) * vector::factor);
-            }
+            Vector<T> tmp_buf;
+            tmp_buf.append(source + first.index, source + last.index);
+            const T* values = std::as_const(tmp_buf).data();
+            return insert(pos, values, values + tmp_buf.size());
+        }
+        else if constexpr (is_forward_iterator<InputIt>)
+        {
+            using reference = typename std::iterator_traits<InputIt>::reference;
+            constexpr bool shift
+                = std::is_nothrow_constructible_v<T, reference> && std::is_nothrow_assignable_v<T&, reference>;
+
+            const auto count = static_cast<std::size_t>(std::distance(first, last));
 
-            if (pos == end())
+            if (count != 0)
             {
-                storage->size += count;
-                std::uninitialized_copy(first, last, pos);
-            }
-            else
-            {
-                storage->size += count;
-                if (!std::is_trivially_move_assignable<T>::value)
-                {
-                    std::uninitialized_default_construct_n(end() - count, count);
-                }
-                std::move_backward(pos, end() - count, end());
-                std::copy(first, last, pos);
+                insert_with<shift>(
+                    index,
+                    count,
+                    [&first, &last](T* place) { std::uninitialized_copy(first, last, place); },
+                    [this, index, count, &first, &last] { insert_uninitialized(index, count, first, last); });
             }
         }
+        else
+        {
+            Vector<T> tmp_buf;
+            tmp_buf.append(first, last);
+            T* values = tmp_buf.data();
+            return insert(pos, std::make_move_iterator(values), std::make_move_iterator(values + tmp_buf.size()));
+        }
+
+        return iterator(this, index);
+    }
 
-        return iterator(pos);
+    constexpr iterator insert(const_iterator pos, std::initializer_list<T> values)
+    {
+        return insert(pos, values.begin(), values.end());
     }
 };
 
-}  // namespace vector
\ No newline at end of file
+template <typename T, typename U>
+constexpr std::size_t erase(Vector<T>& vec, const U& value)
+{
+    return vec.erase_if([&value](const T& elem) { return elem == value; });
+}
+
+template <typename T, typename Pred>
+constexpr std::size_t erase_if(Vector<T>& vec, Pred pred)
+{
+    return vec.erase_if(pred);
+}
+
+}  // namespace vector
+
+// Element types compiled into the vector::instantiations library (src/instantiations.cpp). Code linking it gets
+// VECTOR_EXTERN_TEMPLATES, which declares those instantiations here so that each translation unit stops compiling
+// its own copy. The library and its users must agree on VECTOR_HARDENING_LEVEL, like every other translation unit.
+#define VECTOR_COMMON_ELEMENT_TYPES(X) X(int) X(double) X(std::string) X(std::byte)
+
+#if defined(VECTOR_EXTERN_TEMPLATES)
+#include <cstddef>
+#include <string>
+
+#define VECTOR_DECLARE_INSTANTIATION(T)           \
+    extern template struct vector::VecStorage<T>; \
+    extern template class vector::Vector<T>;
+VECTOR_COMMON_ELEMENT_TYPES(VECTOR_DECLARE_INSTANTIATION)
+#undef VECTOR_DECLARE_INSTANTIATION
+#endif
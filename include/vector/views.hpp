@@ -0,0 +1,895 @@
+#pragma once
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector/vector.hpp>
+
+// Lazy views over Vector. A pipeline such as
+//
+//     vec | views::filter(pred) | views::transform(f) | collect()
+//
+// visits every element once and builds only the final Vector. Views refer to the elements of the vector they
+// were made from and must not outlive it or be used after it is modified.
+
+namespace vector {
+
+namespace views {
+
+struct ViewBase
+{
+};
+
+template <typename V>
+concept View = std::derived_from<V, ViewBase>;
+
+template <typename V>
+concept SizedView = View<V> && requires(const V& view) { view.size(); };
+
+template <typename V>
+using iterator_t = decltype(std::declval<const V&>().begin());
+
+template <typename It>
+using reference_t = decltype(*std::declval<const It&>());
+
+namespace detail {
+
+// Zip and enumerate use a pair of references as their value type, since before C++23 it has no common reference
+// with a pair of values and the iterators would not model the standard concepts. collect() stores the values.
+template <typename T>
+struct owned
+{
+    using type = T;
+};
+
+template <typename First, typename Second>
+struct owned<std::pair<First, Second>>
+{
+    using type = std::pair<std::remove_cvref_t<First>, std::remove_cvref_t<Second>>;
+};
+
+template <typename T>
+using owned_t = typename owned<T>::type;
+
+}  // namespace detail
+
+template <typename It>
+class Subrange;
+
+namespace detail {
+
+// A chunk's Subrange points into the chunk view, which may hold the function of a transform or filter below it,
+// so collect() copies each chunk into a Vector of its values.
+template <typename It>
+struct owned<Subrange<It>>
+{
+    using type = Vector<owned_t<std::iter_value_t<It>>>;
+};
+
+template <typename T>
+inline constexpr bool is_subrange = false;
+
+template <typename It>
+inline constexpr bool is_subrange<Subrange<It>> = true;
+
+template <typename It>
+using concept_for = std::conditional_t<
+    std::random_access_iterator<It>,
+    std::random_access_iterator_tag,
+    std::conditional_t<std::bidirectional_iterator<It>, std::bidirectional_iterator_tag, std::forward_iterator_tag>>;
+
+// Derives the remaining iterator operations from ++, --, += and difference; the random access ones are only
+// available when Derived provides += and difference.
+template <typename Derived>
+class IteratorOps
+{
+    Derived& self() noexcept
+    {
+        return static_cast<Derived&>(*this);
+    }
+    const Derived& self() const noexcept
+    {
+        return static_cast<const Derived&>(*this);
+    }
+
+   public:
+    Derived operator++(int)
+    {
+        Derived it(self());
+        ++self();
+        return it;
+    }
+    Derived operator--(int)
+    {
+        Derived it(self());
+        --self();
+        return it;
+    }
+    Derived& operator-=(std::ptrdiff_t offset)
+    {
+        return self() += -offset;
+    }
+    friend Derived operator+(Derived it, std::ptrdiff_t offset)
+    {
+        return it += offset;
+    }
+    friend Derived operator+(std::ptrdiff_t offset, Derived it)
+    {
+        return it += offset;
+    }
+    friend Derived operator-(Derived it, std::ptrdiff_t offset)
+    {
+        return it += -offset;
+    }
+    decltype(auto) operator[](std::ptrdiff_t offset) const
+    {
+        return *(self() + offset);
+    }
+};
+
+}  // namespace detail
+
+// The elements of a Vector as a view; reading through data() never unshares a copy-on-write buffer.
+template <typename T>
+class RefView : public ViewBase
+{
+    const T* first = nullptr;
+    const T* last = nullptr;
+
+   public:
+    RefView() = default;
+
+    explicit RefView(const Vector<T>& vec) : first(vec.data()), last(vec.data() + vec.size())
+    {
+    }
+
+    [[nodiscard]] const T* begin() const noexcept
+    {
+        return first;
+    }
+    [[nodiscard]] const T* end() const noexcept
+    {
+        return last;
+    }
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return static_cast<std::size_t>(last - first);
+    }
+};
+
+// An iterator pair; chunk() yields these.
+template <typename It>
+class Subrange : public ViewBase
+{
+    It first;
+    It last;
+
+   public:
+    Subrange() = default;
+
+    Subrange(It first, It last) : first(std::move(first)), last(std::move(last))
+    {
+    }
+
+    [[nodiscard]] It begin() const
+    {
+        return first;
+    }
+    [[nodiscard]] It end() const
+    {
+        return last;
+    }
+    [[nodiscard]] std::size_t size() const
+        requires std::sized_sentinel_for<It, It>
+    {
+        return static_cast<std::size_t>(last - first);
+    }
+    [[nodiscard]] bool empty() const
+    {
+        return first == last;
+    }
+};
+
+template <typename T>
+RefView<T> all(const Vector<T>& vec)
+{
+    return RefView<T>(vec);
+}
+
+// A view of a temporary would dangle.
+template <typename T>
+void all(Vector<T>&& vec) = delete;
+
+template <View V>
+V all(V view)
+{
+    return view;
+}
+
+template <typename R>
+using all_t = decltype(all(std::declval<R>()));
+
+// Result of calling a view factory without its range argument; applied with `range | adaptor`.
+template <typename Make>
+struct Adaptor
+{
+    Make make;
+
+    template <typename R>
+    friend auto operator|(R&& range, const Adaptor& adaptor) -> decltype(adaptor.make(all(std::forward<R>(range))))
+    {
+        return adaptor.make(all(std::forward<R>(range)));
+    }
+};
+
+template <typename Make>
+Adaptor(Make) -> Adaptor<Make>;
+
+template <View Base, typename F>
+class TransformView : public ViewBase
+{
+    using BaseIt = iterator_t<Base>;
+
+    Base base;
+    F func;
+
+   public:
+    class Iterator : public detail::IteratorOps<Iterator>
+    {
+        BaseIt current{};
+        const F* func = nullptr;
+
+       public:
+        using value_type = std::remove_cvref_t<std::invoke_result_t<const F&, reference_t<BaseIt>>>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = detail::concept_for<BaseIt>;
+        using iterator_category = std::input_iterator_tag;
+        using detail::IteratorOps<Iterator>::operator++;
+        using detail::IteratorOps<Iterator>::operator--;
+
+        Iterator() = default;
+
+        Iterator(BaseIt current, const F* func) : current(std::move(current)), func(func)
+        {
+        }
+
+        decltype(auto) operator*() const
+        {
+            return std::invoke(*func, *current);
+        }
+
+        Iterator& operator++()
+        {
+            ++current;
+            return *this;
+        }
+        Iterator& operator--()
+            requires std::bidirectional_iterator<BaseIt>
+        {
+            --current;
+            return *this;
+        }
+        Iterator& operator+=(difference_type offset)
+            requires std::random_access_iterator<BaseIt>
+        {
+            current += offset;
+            return *this;
+        }
+        friend difference_type operator-(const Iterator& lhs, const Iterator& rhs)
+            requires std::random_access_iterator<BaseIt>
+        {
+            return lhs.current - rhs.current;
+        }
+
+        bool operator==(const Iterator& rhs) const
+        {
+            return current == rhs.current;
+        }
+        auto operator<=>(const Iterator& rhs) const
+            requires std::random_access_iterator<BaseIt>
+        {
+            return current <=> rhs.current;
+        }
+    };
+
+    TransformView(Base base, F func) : base(std::move(base)), func(std::move(func))
+    {
+    }
+
+    [[nodiscard]] Iterator begin() const
+    {
+        return Iterator(base.begin(), &func);
+    }
+    [[nodiscard]] Iterator end() const
+    {
+        return Iterator(base.end(), &func);
+    }
+    [[nodiscard]] std::size_t size() const
+        requires SizedView<Base>
+    {
+        return base.size();
+    }
+};
+
+template <View Base, typename Pred>
+class FilterView : public ViewBase
+{
+    using BaseIt = iterator_t<Base>;
+
+    Base base;
+    Pred pred;
+
+   public:
+    class Iterator : public detail::IteratorOps<Iterator>
+    {
+        BaseIt current{};
+        BaseIt last{};
+        const Pred* pred = nullptr;
+
+        void skip()
+        {
+            while ((current != last) && !std::invoke(*pred, *current))
+            {
+                ++current;
+            }
+        }
+
+       public:
+        using value_type = std::iter_value_t<BaseIt>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using detail::IteratorOps<Iterator>::operator++;
+
+        Iterator() = default;
+
+        Iterator(BaseIt current, BaseIt last, const Pred* pred) :
+            current(std::move(current)),
+            last(std::move(last)),
+            pred(pred)
+        {
+            skip();
+        }
+
+        decltype(auto) operator*() const
+        {
+            return *current;
+        }
+
+        Iterator& operator++()
+        {
+            ++current;
+            skip();
+            return *this;
+        }
+
+        bool operator==(const Iterator& rhs) const
+        {
+            return current == rhs.current;
+        }
+    };
+
+    FilterView(Base base, Pred pred) : base(std::move(base)), pred(std::move(pred))
+    {
+    }
+
+    // Finds the first match on every call.
+    [[nodiscard]] Iterator begin() const
+    {
+        return Iterator(base.begin(), base.end(), &pred);
+    }
+    [[nodiscard]] Iterator end() const
+    {
+        return Iterator(base.end(), base.end(), &pred);
+    }
+};
+
+// Pairs up the elements of two views and stops at the end of the shorter one.
+template <View First, View Second>
+class ZipView : public ViewBase
+{
+    using FirstIt = iterator_t<First>;
+    using SecondIt = iterator_t<Second>;
+
+    static constexpr bool random_access = std::random_access_iterator<FirstIt> && std::random_access_iterator<SecondIt>;
+
+    First first;
+    Second second;
+
+   public:
+    class Iterator : public detail::IteratorOps<Iterator>
+    {
+        FirstIt first{};
+        SecondIt second{};
+
+       public:
+        using reference = std::pair<reference_t<FirstIt>, reference_t<SecondIt>>;
+        using value_type = reference;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept
+            = std::conditional_t<random_access, std::random_access_iterator_tag, std::forward_iterator_tag>;
+        using iterator_category = std::input_iterator_tag;
+        using detail::IteratorOps<Iterator>::operator++;
+        using detail::IteratorOps<Iterator>::operator--;
+
+        Iterator() = default;
+
+        Iterator(FirstIt first, SecondIt second) : first(std::move(first)), second(std::move(second))
+        {
+        }
+
+        reference operator*() const
+        {
+            return reference(*first, *second);
+        }
+
+        Iterator& operator++()
+        {
+            ++first;
+            ++second;
+            return *this;
+        }
+        Iterator& operator--()
+            requires random_access
+        {
+            --first;
+            --second;
+            return *this;
+        }
+        Iterator& operator+=(difference_type offset)
+            requires random_access
+        {
+            first += offset;
+            second += offset;
+            return *this;
+        }
+        friend difference_type operator-(const Iterator& lhs, const Iterator& rhs)
+            requires random_access
+        {
+            return lhs.first - rhs.first;
+        }
+
+        // Either side reaching its end ends the zip, so end() may pair up two ends that are not in step.
+        bool operator==(const Iterator& rhs) const
+        {
+            return (first == rhs.first) || (second == rhs.second);
+        }
+        auto operator<=>(const Iterator& rhs) const
+            requires random_access
+        {
+            return first <=> rhs.first;
+        }
+    };
+
+    ZipView(First first, Second second) : first(std::move(first)), second(std::move(second))
+    {
+    }
+
+    [[nodiscard]] Iterator begin() const
+    {
+        return Iterator(first.begin(), second.begin());
+    }
+    [[nodiscard]] Iterator end() const
+    {
+        if constexpr (random_access && SizedView<First> && SizedView<Second>)
+        {
+            const auto count = static_cast<std::ptrdiff_t>(size());
+            return Iterator(first.begin() + count, second.begin() + count);
+        }
+        else
+        {
+            return Iterator(first.end(), second.end());
+        }
+    }
+    [[nodiscard]] std::size_t size() const
+        requires SizedView<First> && SizedView<Second>
+    {
+        return std::min<std::size_t>(first.size(), second.size());
+    }
+};
+
+// Pairs every element with its position.
+template <View Base>
+class EnumerateView : public ViewBase
+{
+    using BaseIt = iterator_t<Base>;
+
+    Base base;
+
+   public:
+    class Iterator : public detail::IteratorOps<Iterator>
+    {
+        BaseIt current{};
+        std::size_t index = 0;
+
+       public:
+        using reference = std::pair<std::size_t, reference_t<BaseIt>>;
+        using value_type = reference;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = detail::concept_for<BaseIt>;
+        using iterator_category = std::input_iterator_tag;
+        using detail::IteratorOps<Iterator>::operator++;
+        using detail::IteratorOps<Iterator>::operator--;
+
+        Iterator() = default;
+
+        Iterator(BaseIt current, std::size_t index) : current(std::move(current)), index(index)
+        {
+        }
+
+        reference operator*() const
+        {
+            return reference(index, *current);
+        }
+
+        Iterator& operator++()
+        {
+            ++current;
+            ++index;
+            return *this;
+        }
+        Iterator& operator--()
+            requires std::bidirectional_iterator<BaseIt>
+        {
+            --current;
+            --index;
+            return *this;
+        }
+        Iterator& operator+=(difference_type offset)
+            requires std::random_access_iterator<BaseIt>
+        {
+            current += offset;
+            index += static_cast<std::size_t>(offset);
+            return *this;
+        }
+        friend difference_type operator-(const Iterator& lhs, const Iterator& rhs)
+            requires std::random_access_iterator<BaseIt>
+        {
+            return lhs.current - rhs.current;
+        }
+
+        bool operator==(const Iterator& rhs) const
+        {
+            return current == rhs.current;
+        }
+        auto operator<=>(const Iterator& rhs) const
+            requires std::random_access_iterator<BaseIt>
+        {
+            return current <=> rhs.current;
+        }
+    };
+
+    explicit EnumerateView(Base base) : base(std::move(base))
+    {
+    }
+
+    [[nodiscard]] Iterator begin() const
+    {
+        return Iterator(base.begin(), 0);
+    }
+    // The index of end() is only meaningful when the base is sized.
+    [[nodiscard]] Iterator end() const
+    {
+        if constexpr (SizedView<Base>)
+        {
+            return Iterator(base.end(), base.size());
+        }
+        else
+        {
+            return Iterator(base.end(), 0);
+        }
+    }
+    [[nodiscard]] std::size_t size() const
+        requires SizedView<Base>
+    {
+        return base.size();
+    }
+};
+
+// Every step-th element, starting with the first.
+template <View Base>
+class StrideView : public ViewBase
+{
+    using BaseIt = iterator_t<Base>;
+
+    Base base;
+    std::ptrdiff_t step;
+
+   public:
+    class Iterator : public detail::IteratorOps<Iterator>
+    {
+        BaseIt current{};
+        BaseIt last{};
+        std::ptrdiff_t step = 1;
+
+       public:
+        using value_type = std::iter_value_t<BaseIt>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using detail::IteratorOps<Iterator>::operator++;
+
+        Iterator() = default;
+
+        Iterator(BaseIt current, BaseIt last, std::ptrdiff_t step) :
+            current(std::move(current)),
+            last(std::move(last)),
+            step(step)
+        {
+        }
+
+        decltype(auto) operator*() const
+        {
+            return *current;
+        }
+
+        Iterator& operator++()
+        {
+            current = std::ranges::next(current, step, last);
+            return *this;
+        }
+
+        bool operator==(const Iterator& rhs) const
+        {
+            return current == rhs.current;
+        }
+    };
+
+    StrideView(Base base, std::size_t step) : base(std::move(base)), step(static_cast<std::ptrdiff_t>(step))
+    {
+        VECTOR_HARDENING_ASSERT(step != 0, "stride of zero");
+    }
+
+    [[nodiscard]] Iterator begin() const
+    {
+        return Iterator(base.begin(), base.end(), step);
+    }
+    [[nodiscard]] Iterator end() const
+    {
+        return Iterator(base.end(), base.end(), step);
+    }
+    [[nodiscard]] std::size_t size() const
+        requires SizedView<Base>
+    {
+        const auto count = static_cast<std::size_t>(step);
+        return (base.size() + count - 1) / count;
+    }
+};
+
+// Elements [first, last) of the base, clamped to its end. Holds the base itself rather than iterators into it, since
+// transform and filter iterators point back at their view's function.
+template <View Base>
+class SliceView : public ViewBase
+{
+    using BaseIt = iterator_t<Base>;
+
+    Base base;
+    std::ptrdiff_t first;
+    std::ptrdiff_t count;
+
+   public:
+    SliceView(Base base, std::size_t first, std::size_t last) :
+        base(std::move(base)),
+        first(static_cast<std::ptrdiff_t>(first)),
+        count(static_cast<std::ptrdiff_t>(std::max(first, last) - first))
+    {
+    }
+
+    [[nodiscard]] BaseIt begin() const
+    {
+        return std::ranges::next(base.begin(), first, base.end());
+    }
+    [[nodiscard]] BaseIt end() const
+    {
+        return std::ranges::next(begin(), count, base.end());
+    }
+    [[nodiscard]] std::size_t size() const
+        requires SizedView<Base>
+    {
+        const std::size_t total = base.size();
+        const std::size_t start = std::min(static_cast<std::size_t>(first), total);
+        return std::min(static_cast<std::size_t>(count), total - start);
+    }
+    [[nodiscard]] bool empty() const
+    {
+        return begin() == end();
+    }
+};
+
+// Consecutive runs of `count` elements as Subranges into this view; the last one may be shorter.
+template <View Base>
+class ChunkView : public ViewBase
+{
+    using BaseIt = iterator_t<Base>;
+
+    Base base;
+    std::ptrdiff_t count;
+
+   public:
+    class Iterator : public detail::IteratorOps<Iterator>
+    {
+        BaseIt current{};
+        BaseIt next{};
+        BaseIt last{};
+        std::ptrdiff_t count = 1;
+
+       public:
+        using value_type = Subrange<BaseIt>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using detail::IteratorOps<Iterator>::operator++;
+
+        Iterator() = default;
+
+        Iterator(BaseIt current, BaseIt last, std::ptrdiff_t count) :
+            current(current),
+            next(std::ranges::next(current, count, last)),
+            last(std::move(last)),
+            count(count)
+        {
+        }
+
+        value_type operator*() const
+        {
+            return value_type(current, next);
+        }
+
+        Iterator& operator++()
+        {
+            current = next;
+            next = std::ranges::next(next, count, last);
+            return *this;
+        }
+
+        bool operator==(const Iterator& rhs) const
+        {
+            return current == rhs.current;
+        }
+    };
+
+    ChunkView(Base base, std::size_t count) : base(std::move(base)), count(static_cast<std::ptrdiff_t>(count))
+    {
+        VECTOR_HARDENING_ASSERT(count != 0, "chunk size of zero");
+    }
+
+    [[nodiscard]] Iterator begin() const
+    {
+        return Iterator(base.begin(), base.end(), count);
+    }
+    [[nodiscard]] Iterator end() const
+    {
+        return Iterator(base.end(), base.end(), count);
+    }
+    [[nodiscard]] std::size_t size() const
+        requires SizedView<Base>
+    {
+        const auto chunk = static_cast<std::size_t>(count);
+        return (base.size() + chunk - 1) / chunk;
+    }
+};
+
+template <typename R, typename F>
+auto transform(R&& range, F func)
+{
+    return TransformView<all_t<R>, F>(all(std::forward<R>(range)), std::move(func));
+}
+
+template <typename F>
+auto transform(F func)
+{
+    return Adaptor{[func = std::move(func)]<View V>(V view) { return TransformView<V, F>(std::move(view), func); }};
+}
+
+template <typename R, typename Pred>
+auto filter(R&& range, Pred pred)
+{
+    return FilterView<all_t<R>, Pred>(all(std::forward<R>(range)), std::move(pred));
+}
+
+template <typename Pred>
+auto filter(Pred pred)
+{
+    return Adaptor{[pred = std::move(pred)]<View V>(V view) { return FilterView<V, Pred>(std::move(view), pred); }};
+}
+
+template <typename R1, typename R2>
+auto zip(R1&& first, R2&& second)
+{
+    return ZipView<all_t<R1>, all_t<R2>>(all(std::forward<R1>(first)), all(std::forward<R2>(second)));
+}
+
+template <typename R>
+auto enumerate(R&& range)
+{
+    return EnumerateView<all_t<R>>(all(std::forward<R>(range)));
+}
+
+inline auto enumerate()
+{
+    return Adaptor{[]<View V>(V view) { return EnumerateView<V>(std::move(view)); }};
+}
+
+template <typename R>
+auto stride(R&& range, std::size_t step)
+{
+    return StrideView<all_t<R>>(all(std::forward<R>(range)), step);
+}
+
+inline auto stride(std::size_t step)
+{
+    return Adaptor{[step]<View V>(V view) { return StrideView<V>(std::move(view), step); }};
+}
+
+template <typename R>
+auto chunk(R&& range, std::size_t count)
+{
+    return ChunkView<all_t<R>>(all(std::forward<R>(range)), count);
+}
+
+inline auto chunk(std::size_t count)
+{
+    return Adaptor{[count]<View V>(V view) { return ChunkView<V>(std::move(view), count); }};
+}
+
+// Elements [first, last) of the range, clamped to its end. O(1) for random access views; otherwise the bounds
+// are found by walking the range.
+template <typename R>
+auto slice(R&& range, std::size_t first, std::size_t last)
+{
+    return SliceView<all_t<R>>(all(std::forward<R>(range)), first, last);
+}
+
+inline auto slice(std::size_t first, std::size_t last)
+{
+    return Adaptor{[first, last]<View V>(V view) { return slice(std::move(view), first, last); }};
+}
+
+}  // namespace views
+
+// Builds a Vector from a range in one pass. When the range knows its size the result is allocated once with
+// exactly that capacity; otherwise it grows as push_back does. The element type defaults to the range's, with each
+// chunk of a chunk view copied into a Vector of its own.
+template <typename U = void, typename R>
+auto collect(R&& range)
+{
+    auto view = views::all(std::forward<R>(range));
+    using Source = views::detail::owned_t<std::iter_value_t<views::iterator_t<decltype(view)>>>;
+    using Out = std::conditional_t<std::is_void_v<U>, Source, U>;
+
+    Vector<Out> out = [&view] {
+        if constexpr (views::SizedView<decltype(view)>)
+        {
+            return Vector<Out>(std::max<std::size_t>(view.size(), 1));
+        }
+        else
+        {
+            return Vector<Out>();
+        }
+    }();
+
+    for (auto&& elem : view)
+    {
+        if constexpr (views::detail::is_subrange<std::remove_cvref_t<decltype(elem)>>)
+        {
+            out.emplace_back(collect(elem));
+        }
+        else
+        {
+            out.emplace_back(std::forward<decltype(elem)>(elem));
+        }
+    }
+    return out;
+}
+
+template <typename U = void>
+auto collect()
+{
+    return views::Adaptor{[]<views::View V>(V view) { return collect<U>(std::move(view)); }};
+}
+
+}  // namespace vector
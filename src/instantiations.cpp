@@ -0,0 +1,8 @@
+#include <vector/vector.hpp>
+#include <cstddef>
+#include <string>
+
+#define VECTOR_INSTANTIATE(T)              \
+    template struct vector::VecStorage<T>; \
+    template class vector::Vector<T>;
+VECTOR_COMMON_ELEMENT_TYPES(VECTOR_INSTANTIATE)
@@ -0,0 +1,151 @@
+#include <vector/vector.hpp>
+#include <vector/arena.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+struct Counted
+{
+    static inline int alive = 0;
+
+    Counted()
+    {
+        ++alive;
+    }
+    Counted(const Counted& /*other*/)
+    {
+        ++alive;
+    }
+    Counted(Counted&& /*other*/) noexcept
+    {
+        ++alive;
+    }
+    Counted& operator=(const Counted&) = default;
+    Counted& operator=(Counted&&) noexcept = default;
+    ~Counted()
+    {
+        --alive;
+    }
+};
+
+}  // namespace
+
+TEST(Arena, AllocateRespectsAlignment)
+{
+    constexpr std::size_t alignment = 64;
+    vector::Arena arena;
+
+    static_cast<void>(arena.allocate(1, 1));
+    void* ptr = arena.allocate(sizeof(double), alignment);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0);
+}
+
+TEST(Arena, DeallocateReclaimsLastAllocation)
+{
+    constexpr std::size_t bytes = 32;
+    vector::Arena arena;
+
+    void* first = arena.allocate(bytes);
+    arena.deallocate(first, bytes);
+    void* second = arena.allocate(bytes);
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(arena.bytes_used(), bytes);
+}
+
+TEST(Arena, TryExpandOnlyLastAllocation)
+{
+    constexpr std::size_t bytes = 32;
+    vector::Arena arena;
+
+    void* first = arena.allocate(bytes);
+    EXPECT_TRUE(arena.try_expand(first, bytes, bytes * 2));
+
+    static_cast<void>(arena.allocate(bytes));
+    EXPECT_FALSE(arena.try_expand(first, bytes * 2, bytes * 4));
+}
+
+TEST(Arena, LargeAllocationGetsOwnChunk)
+{
+    constexpr std::size_t chunk_size = 64;
+    constexpr std::size_t bytes = 1024;
+    vector::Arena arena{chunk_size};
+
+    EXPECT_NE(arena.allocate(bytes), nullptr);
+    EXPECT_EQ(arena.bytes_used(), bytes);
+}
+
+TEST(ArenaVector, PushBack)
+{
+    vector::Arena arena;
+    vector::Vector<std::string> vec{arena};
+
+    const std::vector<std::string> values{"val1", "val2", "val3", "val4", "val5"};
+
+    for (const auto& val : values)
+    {
+        vec.push_back(val);
+    }
+
+    EXPECT_EQ(vec.arena(), &arena);
+    EXPECT_EQ(vec.size(), values.size());
+    EXPECT_GT(arena.bytes_used(), 0);
+
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        EXPECT_EQ(vec[i], values.at(i));
+    }
+}
+
+TEST(ArenaVector, ReserveGrowsInPlace)
+{
+    constexpr std::size_t new_capacity = 64;
+    vector::Arena arena;
+    vector::Vector<int> vec{arena};
+
+    vec.push_back(1);
+    const int* before = &vec[0];
+
+    vec.reserve(new_capacity);
+
+    EXPECT_EQ(vec.capacity(), new_capacity);
+    EXPECT_EQ(&vec[0], before);
+    EXPECT_EQ(vec[0], 1);
+}
+
+TEST(ArenaVector, CopyOnWriteStaysInArena)
+{
+    vector::Arena arena;
+    vector::Vector<std::string> vec{arena};
+    vec.push_back("val1");
+
+    vector::Vector<std::string> copy = vec;
+    copy.push_back("val2");
+
+    EXPECT_EQ(copy.arena(), &arena);
+    EXPECT_EQ(vec.size(), 1);
+    EXPECT_EQ(copy.size(), 2);
+}
+
+TEST(ArenaVector, DestructorsRun)
+{
+    constexpr std::size_t count = 10;
+    vector::Arena arena;
+
+    {
+        vector::Vector<Counted> vec{arena};
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            vec.push_back(Counted{});
+        }
+
+        EXPECT_EQ(Counted::alive, count);
+    }
+
+    EXPECT_EQ(Counted::alive, 0);
+}
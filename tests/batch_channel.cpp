@@ -0,0 +1,216 @@
+#include <vector/batch_channel.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+constexpr int batches = 200;
+constexpr int per_batch = 100;
+
+vector::Task produce(vector::BatchChannel<int>& channel)
+{
+    vector::Vector<int> batch;
+    for (int b = 0; b < batches; b++)
+    {
+        for (int i = 0; i < per_batch; i++)
+        {
+            batch.push_back(b * per_batch + i);
+        }
+        co_await channel.async_send(batch);
+    }
+    channel.close();
+}
+
+vector::Task consume(vector::BatchChannel<int>& channel, std::int64_t& sum, bool& in_order)
+{
+    int expected = 0;
+    while (std::optional<vector::Vector<int>> batch = co_await channel.async_receive())
+    {
+        for (const int value : std::as_const(*batch))
+        {
+            in_order = in_order && (value == expected++);
+            sum += value;
+        }
+        channel.recycle(std::move(*batch));
+    }
+}
+
+vector::Task receive_once(vector::BatchChannel<int>& channel, std::optional<vector::Vector<int>>& result)
+{
+    result = co_await channel.async_receive();
+}
+
+vector::Task close_channel(vector::BatchChannel<int>& channel)
+{
+    channel.close();
+    co_return;
+}
+
+vector::Task fail()
+{
+    throw std::runtime_error("task failed");
+    co_return;
+}
+
+constexpr std::int64_t total = std::int64_t{batches} * per_batch * (batches * per_batch - 1) / 2;
+
+}  // namespace
+
+TEST(BatchChannel, BlockingTransferAcrossThreads)
+{
+    vector::BatchChannel<int> channel(4);
+
+    std::thread producer([&channel] {
+        vector::Vector<int> batch;
+        for (int b = 0; b < batches; b++)
+        {
+            for (int i = 0; i < per_batch; i++)
+            {
+                batch.push_back(b * per_batch + i);
+            }
+            ASSERT_TRUE(channel.send(batch));
+            ASSERT_TRUE(batch.empty());
+        }
+        channel.close();
+    });
+
+    std::int64_t sum = 0;
+    int expected = 0;
+    while (std::optional<vector::Vector<int>> batch = channel.receive())
+    {
+        for (const int value : std::as_const(*batch))
+        {
+            ASSERT_EQ(value, expected++);
+            sum += value;
+        }
+        channel.recycle(std::move(*batch));
+    }
+    producer.join();
+
+    EXPECT_EQ(sum, total);
+    EXPECT_TRUE(channel.closed());
+}
+
+TEST(BatchChannel, SendHandsBackRecycledBuffers)
+{
+    vector::BatchChannel<int> channel(2);
+    vector::Vector<int> batch(1000);
+    batch.push_back(1);
+    const int* buffer = std::as_const(batch).data();
+
+    ASSERT_TRUE(channel.send(batch));
+    EXPECT_NE(std::as_const(batch).data(), buffer);
+
+    std::optional<vector::Vector<int>> received = channel.receive();
+    ASSERT_TRUE(received);
+    EXPECT_EQ(std::as_const(*received).data(), buffer);
+    channel.recycle(std::move(*received));
+
+    batch.push_back(2);
+    ASSERT_TRUE(channel.send(batch));
+    EXPECT_EQ(std::as_const(batch).data(), buffer);
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(batch.capacity(), 1000);
+}
+
+TEST(BatchChannel, TryOperationsAndClose)
+{
+    vector::BatchChannel<int> channel(1);
+    vector::Vector<int> batch;
+
+    EXPECT_FALSE(channel.try_receive());
+    batch.push_back(1);
+    EXPECT_TRUE(channel.try_send(batch));
+    batch.push_back(2);
+    EXPECT_FALSE(channel.try_send(batch));
+    EXPECT_EQ(channel.size(), 1);
+
+    channel.close();
+    EXPECT_FALSE(channel.send(batch));
+    EXPECT_EQ(batch.size(), 1);
+
+    const std::optional<vector::Vector<int>> first = channel.receive();
+    ASSERT_TRUE(first);
+    EXPECT_EQ((*first)[0], 1);
+    EXPECT_FALSE(channel.receive());
+}
+
+TEST(BatchChannel, CoroutinesOnOneThread)
+{
+    // Capacity 1 makes both tasks suspend on every other batch.
+    vector::BatchChannel<int> channel(1);
+    std::int64_t sum = 0;
+    bool in_order = true;
+
+    vector::Executor executor;
+    executor.spawn(consume(channel, sum, in_order));
+    executor.spawn(produce(channel));
+    executor.run();
+
+    EXPECT_EQ(sum, total);
+    EXPECT_TRUE(in_order);
+}
+
+TEST(BatchChannel, CoroutineConsumerWithBlockingProducer)
+{
+    vector::BatchChannel<int> channel(2);
+    std::int64_t sum = 0;
+    bool in_order = true;
+
+    vector::Executor executor;
+    executor.spawn(consume(channel, sum, in_order));
+
+    std::thread producer([&channel] {
+        vector::Vector<int> batch;
+        for (int b = 0; b < batches; b++)
+        {
+            for (int i = 0; i < per_batch; i++)
+            {
+                batch.push_back(b * per_batch + i);
+            }
+            channel.send(batch);
+        }
+        channel.close();
+    });
+    executor.run();
+    producer.join();
+
+    EXPECT_EQ(sum, total);
+    EXPECT_TRUE(in_order);
+}
+
+TEST(BatchChannel, CloseWakesSuspendedReceiver)
+{
+    vector::BatchChannel<int> channel(1);
+    std::optional<vector::Vector<int>> result = vector::Vector<int>();
+
+    vector::Executor executor;
+    executor.spawn(receive_once(channel, result));
+    executor.spawn(close_channel(channel));
+    executor.run();
+
+    EXPECT_FALSE(result);
+}
+
+TEST(BatchChannel, FailedTaskRethrowsAndAbandonedWaitersLeave)
+{
+    vector::BatchChannel<int> channel(1);
+    std::optional<vector::Vector<int>> result;
+
+    {
+        vector::Executor executor;
+        executor.spawn(receive_once(channel, result));
+        executor.spawn(fail());
+        EXPECT_THROW(executor.run(), std::runtime_error);
+    }
+
+    // The receiver's frame is gone, so the batch has to be queued rather than handed to it.
+    vector::Vector<int> batch;
+    batch.push_back(7);
+    EXPECT_TRUE(channel.try_send(batch));
+    EXPECT_EQ(channel.size(), 1);
+    EXPECT_FALSE(result);
+}
@@ -0,0 +1,139 @@
+#include <vector/compressed_vector.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace {
+
+vector::Vector<std::uint64_t> sorted_ids(std::size_t count, std::uint64_t max_gap, std::uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    vector::Vector<std::uint64_t> ids(count);
+    std::uint64_t id = 1'000'000'000;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        id += rng() % (max_gap + 1);
+        ids.push_back(id);
+    }
+    return ids;
+}
+
+template <typename T>
+void expect_equal(const vector::CompressedVector<T>& compressed, const vector::Vector<T>& expected)
+{
+    ASSERT_EQ(compressed.size(), expected.size());
+
+    const vector::Vector<T> decoded = compressed.to_vector();
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        ASSERT_EQ(decoded[i], expected[i]) << "at " << i;
+    }
+
+    std::size_t i = 0;
+    for (const T value : compressed)
+    {
+        ASSERT_EQ(value, expected[i++]);
+    }
+    EXPECT_EQ(i, expected.size());
+}
+
+}  // namespace
+
+TEST(CompressedVector, RoundTripsSortedIds)
+{
+    for (const std::size_t count : {0, 1, 127, 128, 129, 1000, 100'000})
+    {
+        const auto ids = sorted_ids(count, 100, count);
+        expect_equal(vector::CompressedVector<std::uint64_t>(ids), ids);
+    }
+}
+
+TEST(CompressedVector, SortedIdsShrink)
+{
+    const auto ids = sorted_ids(100'000, 100, 1);
+    const vector::CompressedVector<std::uint64_t> compressed(ids);
+
+    // Gaps below 128 need 7 bits, plus the block headers.
+    EXPECT_LT(compressed.memory_bytes() * 6, ids.size() * sizeof(std::uint64_t));
+}
+
+TEST(CompressedVector, EvenlySpacedBlocksNeedNoPayload)
+{
+    vector::CompressedVector<std::uint32_t> compressed;
+    for (std::uint32_t i = 0; i < 1280; i++)
+    {
+        compressed.push_back(i * 7);
+    }
+
+    EXPECT_EQ(compressed.block_count(), 10);
+    EXPECT_EQ(compressed[1279], 1279 * 7);
+    EXPECT_LT(compressed.memory_bytes(), 1280);
+}
+
+TEST(CompressedVector, UnsortedAndSignedExtremes)
+{
+    std::mt19937_64 rng(5);
+    vector::Vector<std::int64_t> values;
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        values.push_back(static_cast<std::int64_t>(rng()));
+    }
+    values.push_back(std::numeric_limits<std::int64_t>::min());
+    values.push_back(std::numeric_limits<std::int64_t>::max());
+    values.push_back(0);
+
+    expect_equal(vector::CompressedVector<std::int64_t>(values), values);
+
+    vector::Vector<std::int8_t> small;
+    for (int i = 0; i < 300; i++)
+    {
+        small.push_back(static_cast<std::int8_t>((i * 37) % 256 - 128));
+    }
+    expect_equal(vector::CompressedVector<std::int8_t>(small), small);
+}
+
+TEST(CompressedVector, PushBackMatchesBulk)
+{
+    const auto ids = sorted_ids(5000, 1000, 2);
+
+    vector::CompressedVector<std::uint64_t> appended;
+    for (std::size_t i = 0; i < ids.size(); i++)
+    {
+        appended.push_back(ids[i]);
+    }
+
+    expect_equal(appended, ids);
+    EXPECT_EQ(appended.block_count(), vector::CompressedVector<std::uint64_t>(ids).block_count());
+}
+
+TEST(CompressedVector, RandomAccessAndBounds)
+{
+    const auto ids = sorted_ids(1000, 50, 3);
+    const vector::CompressedVector<std::uint64_t> compressed(ids);
+
+    for (const std::size_t pos : {0, 1, 127, 128, 500, 895, 896, 999})
+    {
+        EXPECT_EQ(compressed[pos], ids[pos]);
+        EXPECT_EQ(compressed.at(pos), ids[pos]);
+    }
+    EXPECT_THROW(static_cast<void>(compressed.at(1000)), std::out_of_range);
+}
+
+TEST(CompressedVector, CopiesAreIndependent)
+{
+    vector::CompressedVector<std::uint32_t> original;
+    for (std::uint32_t i = 0; i < 200; i++)
+    {
+        original.push_back(i);
+    }
+
+    vector::CompressedVector<std::uint32_t> copy = original;
+    copy.push_back(7);
+    original.clear();
+
+    EXPECT_TRUE(original.empty());
+    EXPECT_EQ(copy.size(), 201);
+    EXPECT_EQ(copy[199], 199);
+    EXPECT_EQ(copy[200], 7);
+}
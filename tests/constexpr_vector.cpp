@@ -0,0 +1,141 @@
+#include <vector/constexpr_vector.hpp>
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+constexpr vector::ConstexprVector<int> squares(int count)
+{
+    vector::ConstexprVector<int> values;
+    for (int i = 0; i < count; i++)
+    {
+        values.push_back(i * i);
+    }
+    return values;
+}
+
+constexpr vector::ConstexprVector<int> primes_below(int limit)
+{
+    vector::ConstexprVector<int> primes;
+    for (int candidate = 2; candidate < limit; candidate++)
+    {
+        bool prime = true;
+        for (const int divisor : primes)
+        {
+            prime = prime && (candidate % divisor != 0);
+        }
+        if (prime)
+        {
+            primes.push_back(candidate);
+        }
+    }
+    return primes;
+}
+
+constexpr std::array<std::uint32_t, 256> crc32_table()
+{
+    vector::ConstexprVector<std::uint32_t> table(256);
+    for (std::uint32_t i = 0; i < 256; i++)
+    {
+        std::uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 1U) != 0 ? (crc >> 1U) ^ 0xEDB88320U : crc >> 1U;
+        }
+        table.push_back(crc);
+    }
+    return table.to_array<256>();
+}
+
+}  // namespace
+
+static_assert(squares(10).size() == 10);
+static_assert(squares(10)[9] == 81);
+static_assert(squares(0).empty());
+
+static_assert([] {
+    auto values = squares(5);
+    values.pop_back();
+    values.resize(6, -1);
+    return values.size() == 6 && values[3] == 9 && values[4] == -1 && values[5] == -1;
+}());
+
+static_assert([] {
+    const auto original = squares(4);
+    auto copy = original;
+    copy[0] = 100;
+    return original[0] == 0 && copy[0] == 100 && copy.capacity() == original.capacity();
+}());
+
+static_assert([] {
+    vector::ConstexprVector<int> values{3, 1, 2};
+    auto moved = std::move(values);
+    moved.reserve(32);
+    return moved.capacity() == 32 && moved == vector::ConstexprVector<int>{3, 1, 2};
+}());
+
+static_assert([] {
+    vector::ConstexprVector<std::string> words;
+    words.emplace_back("compile");
+    words.emplace_back("time");
+    return words[0] + "-" + words[1] == "compile-time";
+}());
+
+constexpr auto primes = vector::to_array<[] { return primes_below(50); }>();
+static_assert(primes.size() == 15);
+static_assert(primes.back() == 47);
+
+constexpr auto crc_table = crc32_table();
+static_assert(crc_table[1] == 0x77073096U);
+static_assert(crc_table[255] == 0x2D02EF8DU);
+
+TEST(ConstexprVector, TablesUsableAtRuntime)
+{
+    EXPECT_EQ(primes.front(), 2);
+    EXPECT_EQ(crc_table[128], 0xEDB88320U);
+}
+
+TEST(ConstexprVector, RuntimeBehaviour)
+{
+    vector::ConstexprVector<std::string> values;
+    for (int i = 0; i < 10; i++)
+    {
+        values.push_back(std::to_string(i));
+    }
+
+    EXPECT_EQ(values.size(), 10);
+    EXPECT_EQ(values.at(9), "9");
+    EXPECT_THROW(static_cast<void>(values.at(10)), std::out_of_range);
+}
+
+static_assert([] {
+    vector::ConstexprVector<int> values{7};
+    values.push_back(values[0]);
+    values.resize(5, values[1]);
+    return values == vector::ConstexprVector<int>{7, 7, 7, 7, 7};
+}());
+
+TEST(ConstexprVector, GrowingFromOwnElement)
+{
+    const std::string first(100, 'a');
+    vector::ConstexprVector<std::string> values(1);
+    values.push_back(first);
+    ASSERT_EQ(values.size(), values.capacity());
+
+    values.push_back(values[0]);
+    EXPECT_EQ(values[1], first);
+
+    values.resize(values.capacity() + 3, values[1]);
+    EXPECT_EQ(values.size(), 5);
+    EXPECT_EQ(values[4], first);
+}
+
+TEST(ConstexprVector, ToArraySizeMismatchThrows)
+{
+    const auto values = squares(3);
+
+    EXPECT_THROW(static_cast<void>(values.to_array<2>()), std::length_error);
+}
@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+#include <vector/vector.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Throws from the Nth copy (and, unless NothrowMove, the Nth move) after arm() is called.
+template <bool NothrowMove>
+struct Faulty
+{
+    static inline int countdown = -1;
+    static inline int alive = 0;
+    std::string value;
+
+    static void arm(int operations)
+    {
+        countdown = operations;
+    }
+
+    static void disarm()
+    {
+        countdown = -1;
+    }
+
+    static void tick()
+    {
+        if ((countdown >= 0) && (countdown-- == 0))
+        {
+            throw std::runtime_error("injected fault");
+        }
+    }
+
+    explicit Faulty(std::string value) : value(std::move(value))
+    {
+        ++alive;
+    }
+    Faulty(const Faulty& other) : value((tick(), other.value))
+    {
+        ++alive;
+    }
+    Faulty(Faulty&& other) noexcept(NothrowMove) : value((NothrowMove ? void() : tick(), std::move(other.value)))
+    {
+        ++alive;
+    }
+    Faulty& operator=(const Faulty& other)
+    {
+        tick();
+        value = other.value;
+        return *this;
+    }
+    Faulty& operator=(Faulty&& other) noexcept(NothrowMove)
+    {
+        if constexpr (!NothrowMove)
+        {
+            tick();
+        }
+        value = std::move(other.value);
+        return *this;
+    }
+    ~Faulty()
+    {
+        --alive;
+    }
+};
+
+template <typename T>
+vector::Vector<T> make_vector(std::size_t count, std::size_t capacity)
+{
+    vector::Vector<T> vec(capacity);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        vec.push_back(T("val" + std::to_string(i)));
+    }
+    return vec;
+}
+
+template <typename T>
+std::vector<std::string> contents(const vector::Vector<T>& vec)
+{
+    std::vector<std::string> values;
+    for (std::size_t i = 0; i < vec.size(); i++)
+    {
+        values.push_back(vec[i].value);
+    }
+    return values;
+}
+
+// Runs `op` with a fault injected at every copy/move in turn until it completes, and checks that each failed
+// attempt left the vector exactly as it was and leaked nothing.
+template <typename T, typename Op>
+void expect_strong_guarantee(std::size_t count, std::size_t capacity, Op op)
+{
+    for (int fault = 0;; fault++)
+    {
+        {
+            auto vec = make_vector<T>(count, capacity);
+            const auto before = contents(vec);
+            const std::size_t capacity_before = vec.capacity();
+
+            T::arm(fault);
+            try
+            {
+                op(vec);
+                T::disarm();
+                return;
+            }
+            catch (const std::runtime_error&)
+            {
+                T::disarm();
+            }
+
+            EXPECT_EQ(contents(vec), before) << "fault " << fault;
+            EXPECT_EQ(vec.capacity(), capacity_before) << "fault " << fault;
+        }
+        ASSERT_EQ(T::alive, 0) << "fault " << fault;
+    }
+}
+
+template <typename T>
+class ExceptionSafety : public testing::Test
+{
+};
+
+using FaultyTypes = testing::Types<Faulty<true>, Faulty<false>>;
+TYPED_TEST_SUITE(ExceptionSafety, FaultyTypes);
+
+}  // namespace
+
+TYPED_TEST(ExceptionSafety, PushBackWithReallocation)
+{
+    expect_strong_guarantee<TypeParam>(4, 4, [](auto& vec) {
+        const TypeParam value("new");
+        vec.push_back(value);
+    });
+}
+
+TYPED_TEST(ExceptionSafety, EmplaceBackOwnElementWithReallocation)
+{
+    expect_strong_guarantee<TypeParam>(4, 4, [](auto& vec) { vec.emplace_back(std::as_const(vec)[0]); });
+}
+
+TYPED_TEST(ExceptionSafety, Reserve)
+{
+    expect_strong_guarantee<TypeParam>(4, 4, [](auto& vec) { vec.reserve(32); });
+}
+
+TYPED_TEST(ExceptionSafety, InsertInMiddle)
+{
+    expect_strong_guarantee<TypeParam>(6, 8, [](auto& vec) {
+        const TypeParam value("new");
+        vec.insert(vec.begin() + 2, value);
+    });
+}
+
+TYPED_TEST(ExceptionSafety, InsertInMiddleWithReallocation)
+{
+    expect_strong_guarantee<TypeParam>(4, 4, [](auto& vec) {
+        const TypeParam value("new");
+        vec.insert(vec.begin() + 1, value);
+    });
+}
+
+TYPED_TEST(ExceptionSafety, InsertCount)
+{
+    expect_strong_guarantee<TypeParam>(6, 16, [](auto& vec) {
+        const TypeParam value("new");
+        vec.insert(vec.begin() + 1, 3, value);
+    });
+}
+
+TYPED_TEST(ExceptionSafety, InsertRange)
+{
+    expect_strong_guarantee<TypeParam>(6, 16, [](auto& vec) {
+        const std::vector<TypeParam> values{TypeParam("a"), TypeParam("b"), TypeParam("c")};
+        vec.insert(vec.begin() + 4, values.begin(), values.end());
+    });
+}
+
+TYPED_TEST(ExceptionSafety, ResizeWithReallocation)
+{
+    expect_strong_guarantee<TypeParam>(4, 4, [](auto& vec) { vec.resize(9, TypeParam("fill")); });
+}
+
+TYPED_TEST(ExceptionSafety, PushBackToSharedStorage)
+{
+    expect_strong_guarantee<TypeParam>(4, 8, [](auto& vec) {
+        const auto copy = vec;
+        vec.push_back(TypeParam("new"));
+        EXPECT_EQ(contents(copy).size(), 4);
+    });
+}
+
+TEST(ExceptionSafety, ReserveDoesNotMoveFromSharedStorage)
+{
+    vector::Vector<std::string> vec;
+    vec.append({"val1", "val2", "val3"});
+    const auto copy = vec;
+
+    vec.reserve(16);
+
+    EXPECT_EQ(std::as_const(copy)[0], "val1");
+    EXPECT_EQ(std::as_const(vec)[0], "val1");
+}
+
+TEST(ExceptionSafety, ResizeShrinkDestroysTail)
+{
+    {
+        auto vec = make_vector<Faulty<true>>(5, 5);
+        vec.resize(2, Faulty<true>("fill"));
+        EXPECT_EQ(Faulty<true>::alive, 2);
+    }
+    EXPECT_EQ(Faulty<true>::alive, 0);
+}
+
+TEST(ExceptionSafety, PushBackFromZeroCapacity)
+{
+    vector::Vector<int> vec(0);
+    vec.push_back(1);
+    vec.emplace_back(2);
+
+    EXPECT_EQ(vec.size(), 2);
+    EXPECT_EQ(vec.at(1), 2);
+}
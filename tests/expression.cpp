@@ -0,0 +1,133 @@
+#include <vector/expression.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace vector::arithmetic;
+
+namespace {
+
+template <typename T>
+vector::Vector<T> make(std::initializer_list<T> values)
+{
+    vector::Vector<T> vec;
+    vec.append(values);
+    return vec;
+}
+
+template <typename T>
+std::vector<T> to_std(const vector::Vector<T>& vec)
+{
+    return std::vector<T>(vec.data(), vec.data() + vec.size());
+}
+
+}  // namespace
+
+TEST(Expression, FusedArithmetic)
+{
+    const auto b = make({1.0, 2.0, 3.0});
+    const auto c = make({4.0, 5.0, 6.0});
+    const auto d = make({0.5, 0.5, 0.5});
+
+    vector::Vector<double> a;
+    a = b * c + d;
+    EXPECT_EQ(to_std(a), (std::vector<double>{4.5, 10.5, 18.5}));
+
+    a = (b - c) / 2.0 - -d;
+    EXPECT_EQ(to_std(a), (std::vector<double>{-1.0, -1.0, -1.0}));
+
+    const vector::Vector<double> e = 10.0 - b;
+    EXPECT_EQ(to_std(e), (std::vector<double>{9.0, 8.0, 7.0}));
+}
+
+TEST(Expression, ReusesUniqueBuffer)
+{
+    const auto b = make({1, 2, 3, 4});
+    vector::Vector<int> a(16);
+    a.append({0, 0});
+    const int* buffer = std::as_const(a).data();
+
+    a = b * 2;
+
+    EXPECT_EQ(std::as_const(a).data(), buffer);
+    EXPECT_EQ(a.capacity(), 16);
+    EXPECT_EQ(to_std(a), (std::vector<int>{2, 4, 6, 8}));
+}
+
+TEST(Expression, SharedDestinationIsNotModified)
+{
+    auto a = make({1, 2, 3});
+    const vector::Vector<int> copy = a;
+
+    a = a + 1;
+
+    EXPECT_EQ(to_std(a), (std::vector<int>{2, 3, 4}));
+    EXPECT_EQ(to_std(copy), (std::vector<int>{1, 2, 3}));
+}
+
+TEST(Expression, DestinationMayBeAnOperand)
+{
+    auto a = make({1.0, 2.0, 3.0});
+    const auto b = make({1.0, 1.0, 1.0});
+
+    a = a * a + b;
+    EXPECT_EQ(to_std(a), (std::vector<double>{2.0, 5.0, 10.0}));
+
+    a += 2.0 * b;
+    a *= a;
+    EXPECT_EQ(to_std(a), (std::vector<double>{16.0, 49.0, 144.0}));
+}
+
+TEST(Expression, MixedTypesConvertOnAssignment)
+{
+    const auto ints = make({1, 2, 3});
+
+    const vector::Vector<double> halves = ints * 0.5;
+    EXPECT_EQ(to_std(halves), (std::vector<double>{0.5, 1.0, 1.5}));
+
+    vector::Vector<int> truncated;
+    truncated = halves * 3.0;
+    EXPECT_EQ(to_std(truncated), (std::vector<int>{1, 3, 4}));
+}
+
+TEST(Expression, SizeMismatchThrows)
+{
+    const auto a = make({1, 2, 3});
+    const auto b = make({1, 2});
+
+    EXPECT_THROW(static_cast<void>(a + b), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(dot(a, b)), std::invalid_argument);
+}
+
+TEST(Expression, Reductions)
+{
+    vector::Vector<double> values;
+    for (int i = 1; i <= 100; i++)
+    {
+        values.push_back(i);
+    }
+    const auto ones = values * 0.0 + 1.0;
+
+    EXPECT_DOUBLE_EQ(sum(values), 5050.0);
+    EXPECT_DOUBLE_EQ(sum(values * 2.0), 10100.0);
+    EXPECT_DOUBLE_EQ(dot(values, ones), 5050.0);
+    EXPECT_DOUBLE_EQ(norm(make({3.0, 4.0})), 5.0);
+    EXPECT_EQ(sum(vector::Vector<int>()), 0);
+
+    const auto chars = make<char>({100, 100, 100});
+    EXPECT_EQ(sum(chars), 300);
+}
+
+TEST(Expression, EmptyVectors)
+{
+    const vector::Vector<float> empty;
+    vector::Vector<float> a = make({1.0F});
+
+    a = empty * 2.0F;
+
+    EXPECT_TRUE(a.empty());
+    EXPECT_FLOAT_EQ(norm(empty), 0.0F);
+}
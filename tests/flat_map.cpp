@@ -0,0 +1,148 @@
+#include <vector/flat_map.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Moving throws while `fail` is set, which happens only once the value is being stored in the map.
+struct FailingMove
+{
+    static inline bool fail = false;
+    int value;
+
+    explicit FailingMove(int value) : value(value)
+    {
+    }
+    FailingMove(const FailingMove&) = default;
+    FailingMove(FailingMove&& other) : value(other.value)
+    {
+        if (fail)
+        {
+            throw std::runtime_error("move failed");
+        }
+    }
+    FailingMove& operator=(const FailingMove&) = default;
+    FailingMove& operator=(FailingMove&&) = default;
+};
+
+}  // namespace
+
+TEST(FlatMap, InsertAndFind)
+{
+    vector::FlatMap<int, std::string> map;
+
+    EXPECT_TRUE(map.insert(3, "three"));
+    EXPECT_TRUE(map.insert(1, "one"));
+    EXPECT_FALSE(map.insert(3, "other"));
+
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(*map.find(3), "three");
+    EXPECT_EQ(map.find(2), nullptr);
+    EXPECT_EQ(map.keys()[0], 1);
+    EXPECT_EQ(map.values()[0], "one");
+}
+
+TEST(FlatMap, AtThrowsForMissingKey)
+{
+    const vector::FlatMap<int, int> map{{1, 10}, {2, 20}};
+
+    EXPECT_EQ(map.at(2), 20);
+    EXPECT_THROW(static_cast<void>(map.at(3)), std::out_of_range);
+}
+
+TEST(FlatMap, SubscriptInsertsDefault)
+{
+    vector::FlatMap<std::string, int> map;
+
+    map["b"] += 2;
+    map["a"] += 1;
+    map["b"] += 2;
+
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.at("a"), 1);
+    EXPECT_EQ(map.at("b"), 4);
+}
+
+TEST(FlatMap, InsertOrAssign)
+{
+    vector::FlatMap<int, std::string> map;
+
+    EXPECT_TRUE(map.insert_or_assign(1, "one"));
+    EXPECT_FALSE(map.insert_or_assign(1, "uno"));
+    EXPECT_EQ(map.at(1), "uno");
+}
+
+TEST(FlatMap, Erase)
+{
+    vector::FlatMap<int, int> map{{1, 10}, {2, 20}, {3, 30}};
+
+    EXPECT_EQ(map.erase(2), 1);
+    EXPECT_EQ(map.erase(2), 0);
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.at(3), 30);
+}
+
+TEST(FlatMap, InsertSortedRangeKeepsExistingValues)
+{
+    vector::FlatMap<int, std::string> map{{2, "two"}, {4, "four"}};
+    const std::vector<std::pair<int, std::string>> values{{1, "one"}, {2, "zwei"}, {5, "five"}};
+
+    map.insert_sorted_range(values.begin(), values.end());
+
+    const std::vector<int> exp_keys{1, 2, 4, 5};
+    const std::vector<std::string> exp_values{"one", "two", "four", "five"};
+
+    EXPECT_EQ(map.size(), exp_keys.size());
+    for (std::size_t i = 0; i < map.size(); i++)
+    {
+        EXPECT_EQ(map.keys()[i], exp_keys.at(i));
+        EXPECT_EQ(map.values()[i], exp_values.at(i));
+    }
+}
+
+TEST(FlatMap, IndexedLookup)
+{
+    vector::FlatMap<int, int> map;
+    for (int i = 0; i < 500; i++)
+    {
+        map.insert(i * 2, i);
+    }
+
+    map.build_index();
+
+    for (int key = 0; key < 1000; key++)
+    {
+        const int* value = map.find(key);
+        if (key % 2 == 0)
+        {
+            ASSERT_NE(value, nullptr);
+            EXPECT_EQ(*value, key / 2);
+        }
+        else
+        {
+            EXPECT_EQ(value, nullptr);
+        }
+    }
+
+    map.erase(0);
+    EXPECT_FALSE(map.has_index());
+}
+
+TEST(FlatMap, FailedValueInsertLeavesKeysInStep)
+{
+    vector::FlatMap<int, FailingMove> map;
+    map.try_emplace(1, 10);
+    map.try_emplace(3, 30);
+
+    FailingMove::fail = true;
+    EXPECT_THROW(map.try_emplace(2, 20), std::runtime_error);
+    FailingMove::fail = false;
+
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.keys().size(), map.values().size());
+    EXPECT_EQ(map.find(2), nullptr);
+    EXPECT_EQ(map.at(3).value, 30);
+}
@@ -0,0 +1,139 @@
+#include <vector/flat_set.hpp>
+#include <vector/search.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+TEST(Search, BranchlessLowerBoundMatchesStd)
+{
+    for (int size = 0; size < 70; size++)
+    {
+        std::vector<int> values;
+        for (int i = 0; i < size; i++)
+        {
+            values.push_back(i * 2);
+        }
+
+        for (int key = -1; key <= size * 2; key++)
+        {
+            const auto expected = static_cast<std::size_t>(
+                std::lower_bound(values.begin(), values.end(), key) - values.begin());
+            EXPECT_EQ(vector::branchless_lower_bound(values.data(), values.size(), key), expected);
+        }
+    }
+}
+
+TEST(Search, EytzingerLowerBoundMatchesStd)
+{
+    for (int size = 0; size < 70; size++)
+    {
+        std::vector<int> values;
+        for (int i = 0; i < size; i++)
+        {
+            values.push_back(i * 2);
+        }
+
+        const vector::EytzingerIndex<int> index(values.data(), values.size());
+
+        EXPECT_EQ(index.size(), values.size());
+        for (int key = -1; key <= size * 2; key++)
+        {
+            const auto expected = static_cast<std::size_t>(
+                std::lower_bound(values.begin(), values.end(), key) - values.begin());
+            EXPECT_EQ(index.lower_bound(key), expected);
+        }
+    }
+}
+
+TEST(FlatSet, InsertKeepsSortedUniqueKeys)
+{
+    vector::FlatSet<int> set;
+
+    for (int value : {5, 1, 4, 1, 3, 5, 2})
+    {
+        set.insert(value);
+    }
+
+    const std::vector<int> exp_values{1, 2, 3, 4, 5};
+
+    EXPECT_TRUE(std::equal(set.begin(), set.end(), exp_values.begin(), exp_values.end()));
+}
+
+TEST(FlatSet, InsertReportsDuplicates)
+{
+    vector::FlatSet<std::string> set;
+
+    EXPECT_TRUE(set.insert("val1").second);
+    EXPECT_FALSE(set.insert("val1").second);
+    EXPECT_EQ(*set.insert("val0").first, "val0");
+    EXPECT_EQ(set.size(), 2);
+}
+
+TEST(FlatSet, FindAndContains)
+{
+    const vector::FlatSet<int> set{10, 20, 30};
+
+    EXPECT_TRUE(set.contains(20));
+    EXPECT_FALSE(set.contains(25));
+    EXPECT_EQ(*set.find(30), 30);
+    EXPECT_EQ(set.find(5), set.end());
+    EXPECT_EQ(*set.lower_bound(25), 30);
+    EXPECT_EQ(set.count(10), 1);
+}
+
+TEST(FlatSet, Erase)
+{
+    vector::FlatSet<int> set{1, 2, 3};
+
+    EXPECT_EQ(set.erase(2), 1);
+    EXPECT_EQ(set.erase(2), 0);
+    EXPECT_EQ(set.size(), 2);
+    EXPECT_FALSE(set.contains(2));
+}
+
+TEST(FlatSet, InsertSortedRangeMerges)
+{
+    vector::FlatSet<int> set{1, 4, 7};
+    const std::vector<int> values{0, 2, 4, 4, 8, 9};
+
+    set.insert_sorted_range(values.begin(), values.end());
+
+    const std::vector<int> exp_values{0, 1, 2, 4, 7, 8, 9};
+
+    EXPECT_TRUE(std::equal(set.begin(), set.end(), exp_values.begin(), exp_values.end()));
+}
+
+TEST(FlatSet, IndexedLookupAndInvalidation)
+{
+    vector::FlatSet<int> set;
+    for (int i = 0; i < 1000; i++)
+    {
+        set.insert(i * 3);
+    }
+
+    set.build_index();
+    EXPECT_TRUE(set.has_index());
+
+    for (int key = 0; key < 3000; key++)
+    {
+        EXPECT_EQ(set.contains(key), key % 3 == 0);
+    }
+
+    set.insert(1);
+    EXPECT_FALSE(set.has_index());
+    EXPECT_TRUE(set.contains(1));
+}
+
+TEST(FlatSet, CopySharesStorageUntilWrite)
+{
+    vector::FlatSet<int> set{1, 2, 3};
+    vector::FlatSet<int> copy = set;
+
+    EXPECT_EQ(set.values().data(), copy.values().data());
+
+    copy.insert(4);
+
+    EXPECT_EQ(set.size(), 3);
+    EXPECT_EQ(copy.size(), 4);
+}
@@ -0,0 +1,166 @@
+#include <vector/gather.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename I>
+vector::Vector<I> random_indices(std::size_t count, std::size_t bound, std::uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    vector::Vector<I> indices(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        indices.push_back(static_cast<I>(rng() % bound));
+    }
+    return indices;
+}
+
+template <typename T>
+vector::Vector<T> iota(std::size_t count)
+{
+    vector::Vector<T> values(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        values.push_back(static_cast<T>(i * 3 + 1));
+    }
+    return values;
+}
+
+const vector::GatherOptions option_sets[] = {
+    {},
+    {.prefetch_distance = 0},
+    {.prefetch_distance = 64, .sort_indices = true, .sort_batch = 100},
+};
+
+}  // namespace
+
+template <typename T>
+class Gather : public testing::Test
+{
+};
+
+using GatherTypes = testing::Types<std::uint32_t, std::int64_t, float, double, std::uint16_t>;
+TYPED_TEST_SUITE(Gather, GatherTypes);
+
+TYPED_TEST(Gather, MatchesScalarLoop)
+{
+    const auto source = iota<TypeParam>(5000);
+
+    for (const std::size_t count : {0, 1, 7, 8, 15, 16, 17, 1001})
+    {
+        const auto indices = random_indices<std::uint32_t>(count, source.size(), count);
+        for (const auto& options : option_sets)
+        {
+            const auto out = vector::gather(source, indices, options);
+            ASSERT_EQ(out.size(), count);
+            for (std::size_t i = 0; i < count; i++)
+            {
+                ASSERT_EQ(out[i], source[indices[i]]);
+            }
+        }
+    }
+}
+
+TEST(Gather, WideIndicesAndNonTrivialElements)
+{
+    vector::Vector<std::string> source;
+    source.append({"zero", "one", "two", "three"});
+    vector::Vector<std::uint64_t> indices;
+    indices.append({3, 0, 3, 2});
+
+    const auto out = vector::gather(source, indices);
+
+    EXPECT_EQ(std::vector<std::string>(out.begin(), out.end()),
+              (std::vector<std::string>{"three", "zero", "three", "two"}));
+}
+
+TEST(Gather, OutputMayAliasSource)
+{
+    auto vec = iota<std::uint32_t>(100);
+    vector::Vector<std::uint32_t> reversed(100);
+    for (std::uint32_t i = 0; i < 100; i++)
+    {
+        reversed.push_back(99 - i);
+    }
+
+    vector::gather(vec, reversed, vec);
+
+    EXPECT_EQ(vec[0], 99 * 3 + 1);
+    EXPECT_EQ(vec[99], 1);
+}
+
+TEST(Gather, RejectsOutOfRangeIndex)
+{
+    const auto source = iota<std::uint32_t>(10);
+    vector::Vector<std::uint32_t> indices;
+    indices.append({1, 10});
+    vector::Vector<std::uint32_t> out;
+    out.push_back(42);
+
+    EXPECT_THROW(vector::gather(source, indices, out), std::out_of_range);
+    EXPECT_EQ(out.size(), 1);
+}
+
+TEST(Scatter, LastWriteWinsWithAndWithoutSorting)
+{
+    for (const auto& options : option_sets)
+    {
+        vector::Vector<int> dest;
+        dest.append({0, 0, 0, 0});
+        vector::Vector<std::uint32_t> indices;
+        indices.append({2, 0, 2, 3, 2});
+        vector::Vector<int> values;
+        values.append({1, 2, 3, 4, 5});
+
+        vector::scatter(dest, indices, values, options);
+
+        EXPECT_EQ(std::vector<int>(dest.begin(), dest.end()), (std::vector<int>{2, 0, 5, 4}));
+    }
+}
+
+TEST(Scatter, LeavesSharedCopiesAlone)
+{
+    vector::Vector<int> dest;
+    dest.append({1, 2, 3});
+    const vector::Vector<int> copy = dest;
+    vector::Vector<std::uint32_t> indices;
+    indices.append({1});
+    vector::Vector<int> values;
+    values.append({20});
+
+    vector::scatter(dest, indices, values);
+
+    EXPECT_EQ(dest[1], 20);
+    EXPECT_EQ(copy[1], 2);
+
+    values.push_back(30);
+    EXPECT_THROW(vector::scatter(dest, indices, values), std::invalid_argument);
+    indices.push_back(3);
+    EXPECT_THROW(vector::scatter(dest, indices, values), std::out_of_range);
+}
+
+TEST(ForEachIndexed, VisitsEveryPosition)
+{
+    const auto source = iota<std::uint64_t>(1000);
+    const auto indices = random_indices<std::uint32_t>(5000, source.size(), 9);
+
+    for (const auto& options : option_sets)
+    {
+        std::vector<bool> seen(indices.size());
+        vector::for_each_indexed(
+            source,
+            indices,
+            [&](std::size_t i, std::uint64_t value) {
+                EXPECT_EQ(value, source[indices[i]]);
+                seen[i] = true;
+            },
+            options);
+
+        EXPECT_EQ(std::count(seen.begin(), seen.end(), true), 5000);
+    }
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <vector/vector.hpp>
+
+#include <string>
+
+#if VECTOR_HARDENING_LEVEL >= 1
+
+TEST(HardeningDeathTest, SubscriptOutOfRange)
+{
+    vector::Vector<int> vec;
+    vec.push_back(1);
+
+    EXPECT_DEATH(static_cast<void>(vec[1]), "operator\\[\\] index out of range");
+    EXPECT_DEATH(static_cast<void>(std::as_const(vec)[5]), "operator\\[\\] index out of range");
+}
+
+TEST(HardeningDeathTest, PopBackOnEmpty)
+{
+    vector::Vector<std::string> vec;
+
+    EXPECT_DEATH(vec.pop_back(), "pop_back on empty vector");
+}
+
+TEST(HardeningDeathTest, EraseOutOfRange)
+{
+    vector::Vector<int> vec;
+    vec.append({1, 2, 3});
+
+    EXPECT_DEATH(vec.erase(vec.end()), "erase position out of range");
+    EXPECT_DEATH(vec.erase(vec.begin() + 2, vec.begin() + 1), "erase range out of range");
+}
+
+TEST(HardeningDeathTest, EraseIndicesUnsorted)
+{
+    vector::Vector<int> vec;
+    vec.append({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+
+    const std::size_t indices[] = {100, 2};
+    EXPECT_DEATH(vec.erase_indices(indices), "erase_indices indices not sorted");
+}
+
+TEST(HardeningDeathTest, InsertOutOfRange)
+{
+    vector::Vector<int> vec;
+    vec.append({1, 2, 3});
+
+    EXPECT_DEATH(vec.insert(vec.begin() + 4, 0), "insert position out of range");
+}
+
+#endif
+
+#if VECTOR_HARDENING_LEVEL >= 2
+
+TEST(HardeningDeathTest, IteratorUsedAfterReserve)
+{
+    vector::Vector<int> vec;
+    vec.push_back(1);
+    auto it = vec.begin();
+
+    vec.reserve(16);
+
+    EXPECT_DEATH(static_cast<void>(*it), "iterator used after the vector was modified");
+}
+
+TEST(HardeningDeathTest, IteratorUsedAfterInsert)
+{
+    vector::Vector<int> vec;
+    vec.append({1, 2, 3});
+    auto it = vec.begin() + 1;
+
+    vec.insert(vec.begin(), 0);
+
+    EXPECT_DEATH(static_cast<void>(*it), "iterator used after the vector was modified");
+    EXPECT_DEATH(vec.erase(it), "iterator used after the vector was modified");
+}
+
+TEST(HardeningDeathTest, IteratorFromOtherVector)
+{
+    vector::Vector<int> vec;
+    vector::Vector<int> other;
+    vec.append({1, 2, 3});
+    other.append({1, 2, 3});
+
+    EXPECT_DEATH(vec.erase(other.begin()), "iterator belongs to a different vector");
+}
+
+TEST(Hardening, IteratorsFromMutatorsStayValid)
+{
+    vector::Vector<int> vec;
+    vec.append({1, 2, 4});
+
+    auto it = vec.insert(vec.begin() + 2, 3);
+    EXPECT_EQ(*it, 3);
+
+    it = vec.erase(it);
+    EXPECT_EQ(*it, 4);
+}
+
+#endif
+
+#if VECTOR_ANNOTATE_CONTAINER
+
+TEST(HardeningDeathTest, ReadPastSizeIsReported)
+{
+    vector::Vector<long> vec(8);
+    vec.push_back(1);
+    const long* data = std::as_const(vec).data();
+
+    EXPECT_DEATH(static_cast<void>(*static_cast<const volatile long*>(data + 1)), "container-overflow");
+}
+
+TEST(Hardening, SlackIsAddressableWhileMutating)
+{
+    vector::Vector<long> vec(4);
+    for (long i = 0; i < 100; i++)
+    {
+        vec.insert(vec.begin(), i);
+    }
+    vec.resize(10);
+    vec.shrink_to_fit();
+
+    EXPECT_EQ(vec.size(), 10);
+    EXPECT_EQ(std::as_const(vec)[0], 99);
+}
+
+#endif
@@ -0,0 +1,192 @@
+#include <vector/incremental_vector.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+static_assert(std::random_access_iterator<vector::IncrementalVector<int>::iterator>);
+
+TEST(IncrementalVector, IndexesStayCorrectDuringMigration)
+{
+    vector::IncrementalVector<std::string> vec;
+    bool seen_migration = false;
+
+    for (int i = 0; i < 5000; i++)
+    {
+        vec.push_back(std::to_string(i));
+        seen_migration = seen_migration || vec.migrating();
+
+        if ((i % 97 == 0) || vec.migrating())
+        {
+            for (std::size_t pos = 0; pos < vec.size(); pos += 13)
+            {
+                ASSERT_EQ(vec[pos], std::to_string(pos));
+            }
+            ASSERT_EQ(vec.back(), std::to_string(i));
+        }
+    }
+
+    EXPECT_TRUE(seen_migration);
+    EXPECT_EQ(vec.size(), 5000);
+}
+
+TEST(IncrementalVector, GrowthDefersTheMove)
+{
+    vector::IncrementalVector<int> vec(64);
+    for (int i = 0; i < 64; i++)
+    {
+        vec.push_back(i);
+    }
+    EXPECT_FALSE(vec.migrating());
+
+    vec.push_back(64);
+    EXPECT_EQ(vec.capacity(), 128);
+    EXPECT_TRUE(vec.migrating());
+
+    for (int i = 65; i < 96; i++)
+    {
+        vec.push_back(i);
+    }
+    EXPECT_FALSE(vec.migrating());
+
+    const auto span = vec.contiguous();
+    EXPECT_EQ(span.size(), 96);
+    EXPECT_EQ(span[10], 10);
+    EXPECT_EQ(span[95], 95);
+}
+
+TEST(IncrementalVector, PushOwnElementWhileGrowing)
+{
+    vector::IncrementalVector<std::string> vec(2);
+    vec.push_back("first value long enough to live on the heap");
+    vec.push_back("second");
+
+    vec.push_back(vec[0]);
+
+    EXPECT_EQ(vec[2], vec[0]);
+    EXPECT_EQ(vec[0], "first value long enough to live on the heap");
+}
+
+TEST(IncrementalVector, PopBackDuringMigration)
+{
+    vector::IncrementalVector<std::string> vec(32);
+    for (int i = 0; i < 33; i++)
+    {
+        vec.push_back(std::to_string(i));
+    }
+    ASSERT_TRUE(vec.migrating());
+
+    for (int i = 0; i < 30; i++)
+    {
+        vec.pop_back();
+    }
+    EXPECT_TRUE(vec.migrating());
+    EXPECT_EQ(vec[2], "2");
+
+    vec.pop_back();
+    EXPECT_FALSE(vec.migrating());
+    EXPECT_EQ(vec.size(), 2);
+    EXPECT_EQ(vec[1], "1");
+
+    vec.push_back("2");
+    EXPECT_EQ(vec.back(), "2");
+}
+
+TEST(IncrementalVector, ReserveMigratesLazily)
+{
+    vector::IncrementalVector<int> vec;
+    for (int i = 0; i < 100; i++)
+    {
+        vec.push_back(i);
+    }
+
+    vec.reserve(1000);
+    EXPECT_EQ(vec.capacity(), 1000);
+    EXPECT_TRUE(vec.migrating());
+    EXPECT_EQ(vec[99], 99);
+
+    vec.finish_migration();
+    EXPECT_FALSE(vec.migrating());
+    EXPECT_EQ(vec[99], 99);
+
+    // A growth that starts while an earlier migration is pending finishes that one first.
+    vec.reserve(1001);
+    EXPECT_EQ(vec.capacity(), 1001);
+    vec.reserve(1002);
+    EXPECT_TRUE(std::equal(vec.begin(), vec.end(), vec.contiguous().begin()));
+    EXPECT_EQ(vec.size(), 100);
+}
+
+TEST(IncrementalVector, CopyMoveAndClear)
+{
+    vector::IncrementalVector<std::string> vec(16);
+    for (int i = 0; i < 20; i++)
+    {
+        vec.push_back(std::to_string(i));
+    }
+    ASSERT_TRUE(vec.migrating());
+
+    vector::IncrementalVector<std::string> copy = vec;
+    EXPECT_FALSE(copy.migrating());
+    EXPECT_TRUE(std::equal(vec.begin(), vec.end(), copy.begin(), copy.end()));
+
+    vector::IncrementalVector<std::string> moved = std::move(vec);
+    EXPECT_EQ(moved.size(), 20);
+    EXPECT_EQ(moved[5], "5");
+
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_FALSE(moved.migrating());
+
+    EXPECT_THROW(copy.at(20), std::out_of_range);
+    EXPECT_EQ(copy.at(19), "19");
+}
+
+TEST(IncrementalVector, PushOwnElementDuringReserveMigration)
+{
+    constexpr std::size_t n = 8;
+    vector::IncrementalVector<std::string> vec(n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        vec.push_back(std::string(40, static_cast<char>('a' + i)));
+    }
+
+    vec.reserve(n + 1);
+    vec.push_back("pushed");
+    ASSERT_TRUE(vec.migrating());
+    ASSERT_EQ(vec.size(), vec.capacity());
+
+    vec.push_back(vec[n - 1]);
+    EXPECT_EQ(vec.back(), std::string(40, static_cast<char>('a' + n - 1)));
+    EXPECT_EQ(vec[n], "pushed");
+    EXPECT_EQ(vec[0], std::string(40, 'a'));
+}
+
+TEST(IncrementalVector, ThrowingPushHasNoEffect)
+{
+    struct Fragile
+    {
+        int value;
+        explicit Fragile(int value) : value(value)
+        {
+            if (value < 0)
+            {
+                throw std::runtime_error("negative");
+            }
+        }
+    };
+
+    vector::IncrementalVector<Fragile> vec(4);
+    for (int i = 0; i < 4; i++)
+    {
+        vec.emplace_back(i);
+    }
+
+    EXPECT_THROW(vec.emplace_back(-1), std::runtime_error);
+    EXPECT_EQ(vec.size(), 4);
+    EXPECT_EQ(vec[3].value, 3);
+
+    vec.emplace_back(4);
+    EXPECT_EQ(vec.back().value, 4);
+}
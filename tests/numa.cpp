@@ -0,0 +1,86 @@
+#include <vector/numa.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST(Numa, ParsesKernelLists)
+{
+    EXPECT_EQ(vector::numa::detail::parse_list("0-3,8,10-11\n"), (std::vector<unsigned>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(vector::numa::detail::parse_list("0"), (std::vector<unsigned>{0}));
+    EXPECT_TRUE(vector::numa::detail::parse_list("\n").empty());
+}
+
+TEST(Numa, TopologyIsConsistent)
+{
+    const std::size_t nodes = vector::numa::node_count();
+
+    EXPECT_GE(nodes, 1);
+    EXPECT_LT(vector::numa::current_node(), nodes);
+}
+
+TEST(Numa, PlacementKeepsContents)
+{
+    vector::Vector<std::uint64_t> vec;
+    for (std::uint64_t i = 0; i < 100'000; i++)
+    {
+        vec.push_back(i);
+    }
+
+    const bool interleaved = vector::numa::place(vec, vector::numa::Placement::interleave);
+    const unsigned first_node = vector::numa::detail::topology().nodes[0];
+    const bool bound = vector::numa::place(vec, vector::numa::Placement::bind, first_node);
+    if (vector::numa::node_count() == 1)
+    {
+        EXPECT_FALSE(interleaved);
+        EXPECT_FALSE(bound);
+    }
+
+    for (std::uint64_t i = 0; i < vec.size(); i++)
+    {
+        ASSERT_EQ(std::as_const(vec)[i], i);
+    }
+}
+
+TEST(Numa, ScopedPolicyIsInactiveOnOneNode)
+{
+    const vector::numa::ScopedPolicy policy(vector::numa::Placement::interleave);
+
+    if (vector::numa::node_count() == 1)
+    {
+        EXPECT_FALSE(policy.active());
+    }
+}
+
+TEST(Numa, FirstTouchParallelFillsEveryElement)
+{
+    const auto vec = vector::numa::first_touch_parallel<std::uint32_t>(
+        50'000, [](std::size_t i) { return static_cast<std::uint32_t>(i * 3); });
+
+    ASSERT_EQ(vec.size(), 50'000);
+    for (std::size_t i = 0; i < vec.size(); i++)
+    {
+        ASSERT_EQ(vec[i], i * 3);
+    }
+}
+
+TEST(Numa, ReplicasMatchSource)
+{
+    vector::Vector<std::string> source;
+    source.append({"alpha", "beta", "gamma"});
+
+    const vector::numa::ReplicatedVector<std::string> replicated(source);
+
+    EXPECT_EQ(replicated.replica_count(), vector::numa::node_count());
+    EXPECT_EQ(replicated.size(), 3);
+    EXPECT_EQ(replicated[1], "beta");
+    for (std::size_t node = 0; node < replicated.replica_count(); node++)
+    {
+        EXPECT_EQ(replicated.replica(node)[2], "gamma");
+    }
+    if (vector::numa::node_count() == 1)
+    {
+        EXPECT_EQ(replicated.local().data(), std::as_const(source).data());
+    }
+}
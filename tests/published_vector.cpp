@@ -0,0 +1,132 @@
+#include <vector/published_vector.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(PublishedVector, ReadSeesPublishedVersion)
+{
+    vector::PublishedVector<int> published;
+    auto reader = published.register_reader();
+
+    EXPECT_EQ(reader.read().size(), 0);
+
+    vector::Vector<int> next;
+    next.append({1, 2, 3});
+    published.publish(next);
+
+    const auto guard = reader.read();
+    EXPECT_EQ(guard.size(), 3);
+    EXPECT_EQ(guard[2], 3);
+}
+
+TEST(PublishedVector, UpdateCopiesCurrentVersion)
+{
+    vector::PublishedVector<int> published;
+    auto reader = published.register_reader();
+
+    published.update([](vector::Vector<int>& next) { next.push_back(1); });
+    published.update([](vector::Vector<int>& next) { next.push_back(2); });
+
+    const auto guard = reader.read();
+    EXPECT_TRUE(std::equal(guard.begin(), guard.end(), std::vector<int>{1, 2}.begin()));
+}
+
+TEST(PublishedVector, GuardKeepsRetiredVersionAlive)
+{
+    auto payload = std::make_shared<int>(1);
+    std::weak_ptr<int> observer = payload;
+
+    vector::Vector<std::shared_ptr<int>> initial;
+    initial.push_back(std::move(payload));
+
+    vector::PublishedVector<std::shared_ptr<int>> published(initial);
+    initial.clear();
+    auto reader = published.register_reader();
+
+    {
+        const auto guard = reader.read();
+        published.publish(vector::Vector<std::shared_ptr<int>>());
+
+        EXPECT_EQ(published.reclaim(), 1);
+        EXPECT_FALSE(observer.expired());
+        EXPECT_EQ(*guard[0], 1);
+    }
+
+    EXPECT_EQ(published.reclaim(), 0);
+    EXPECT_TRUE(observer.expired());
+}
+
+TEST(PublishedVector, NestedGuardsShareOneAnnouncement)
+{
+    vector::PublishedVector<int> published;
+    auto reader = published.register_reader();
+
+    {
+        const auto outer = reader.read();
+        {
+            const auto inner = reader.read();
+        }
+        published.publish(vector::Vector<int>());
+        EXPECT_EQ(published.reclaim(), 1);
+    }
+
+    EXPECT_EQ(published.reclaim(), 0);
+}
+
+TEST(PublishedVector, ReaderLimit)
+{
+    vector::PublishedVector<int, 2> published;
+    auto first = published.register_reader();
+    auto second = published.register_reader();
+
+    EXPECT_THROW(static_cast<void>(published.register_reader()), std::length_error);
+}
+
+TEST(PublishedVector, ConcurrentReadersSeeConsistentVersions)
+{
+    constexpr int versions = 200;
+    constexpr int readers_count = 4;
+    constexpr std::size_t length = 64;
+
+    vector::PublishedVector<int> published;
+    std::atomic<bool> done = false;
+    std::atomic<bool> consistent = true;
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < readers_count; i++)
+    {
+        readers.emplace_back([&] {
+            auto reader = published.register_reader();
+            while (!done.load())
+            {
+                const auto guard = reader.read();
+                if (!std::all_of(guard.begin(), guard.end(), [&guard](int value) { return value == guard[0]; }))
+                {
+                    consistent = false;
+                }
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    for (int version = 1; version <= versions; version++)
+    {
+        vector::Vector<int> next;
+        next.resize(length, version);
+        published.publish(next);
+    }
+
+    done = true;
+    for (auto& thread : readers)
+    {
+        thread.join();
+    }
+    published.synchronize();
+
+    EXPECT_TRUE(consistent);
+    EXPECT_EQ(published.reclaim(), 0);
+}
@@ -0,0 +1,235 @@
+#include <vector/ring_vector.hpp>
+#include <gtest/gtest.h>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Counts live instances; copying throws once `copies_left` runs out.
+struct Counted
+{
+    static inline int alive = 0;
+    static inline int copies_left = -1;
+    int value;
+
+    explicit Counted(int value) : value(value)
+    {
+        alive++;
+    }
+    Counted(const Counted& other) : value(other.value)
+    {
+        if (copies_left == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+        copies_left--;
+        alive++;
+    }
+    Counted& operator=(const Counted&) = default;
+    ~Counted()
+    {
+        alive--;
+    }
+};
+
+}  // namespace
+
+TEST(RingVector, PushAndPopBothEnds)
+{
+    vector::RingVector<std::string> ring;
+
+    ring.push_back("val2");
+    ring.push_front("val1");
+    ring.push_back("val3");
+
+    EXPECT_EQ(ring.size(), 3);
+    EXPECT_EQ(ring.front(), "val1");
+    EXPECT_EQ(ring.back(), "val3");
+
+    ring.pop_front();
+    EXPECT_EQ(ring.front(), "val2");
+
+    ring.pop_back();
+    EXPECT_EQ(ring.back(), "val2");
+    EXPECT_EQ(ring.size(), 1);
+}
+
+TEST(RingVector, CapacityIsPowerOfTwo)
+{
+    const vector::RingVector<int> ring(5);
+
+    EXPECT_EQ(ring.capacity(), 8);
+}
+
+TEST(RingVector, WrapAroundAndGrowKeepOrder)
+{
+    vector::RingVector<int> ring(4);
+
+    for (int i = 0; i < 3; i++)
+    {
+        ring.push_back(i);
+    }
+    ring.pop_front();
+    ring.pop_front();
+
+    for (int i = 3; i < 20; i++)
+    {
+        ring.push_back(i);
+    }
+
+    EXPECT_EQ(ring.size(), 18);
+    for (std::size_t i = 0; i < ring.size(); i++)
+    {
+        EXPECT_EQ(ring.at(i), static_cast<int>(i) + 2);
+    }
+}
+
+TEST(RingVector, AtOutOfBounds)
+{
+    vector::RingVector<int> ring;
+    ring.push_back(1);
+
+    EXPECT_THROW(ring.at(1), std::out_of_range);
+}
+
+TEST(RingVector, SpansCoverWrappedElements)
+{
+    vector::RingVector<int> ring(4);
+
+    ring.push_back(1);
+    ring.push_back(2);
+    ring.push_back(3);
+    ring.pop_front();
+    ring.pop_front();
+    ring.push_back(4);
+    ring.push_back(5);
+
+    const auto [first, second] = std::as_const(ring).spans();
+
+    std::vector<int> values(first.begin(), first.end());
+    values.insert(values.end(), second.begin(), second.end());
+
+    EXPECT_EQ(first.size(), 2);
+    EXPECT_EQ(second.size(), 1);
+    EXPECT_EQ(values, (std::vector<int>{3, 4, 5}));
+}
+
+TEST(RingVector, CopyIsIndependent)
+{
+    vector::RingVector<std::string> ring;
+    ring.push_back("val1");
+
+    vector::RingVector<std::string> copy = ring;
+    copy.push_front("val0");
+
+    EXPECT_EQ(ring.size(), 1);
+    EXPECT_EQ(copy.size(), 2);
+    EXPECT_EQ(copy[1], "val1");
+}
+
+TEST(RingVector, FailedCopyDestroysPartialCopies)
+{
+    {
+        vector::RingVector<Counted> ring;
+        for (int i = 0; i < 5; i++)
+        {
+            ring.emplace_back(i);
+        }
+
+        Counted::copies_left = 3;
+        EXPECT_THROW(vector::RingVector<Counted> copy(ring), std::runtime_error);
+        Counted::copies_left = -1;
+        EXPECT_EQ(Counted::alive, 5);
+    }
+    EXPECT_EQ(Counted::alive, 0);
+}
+
+TEST(SpscRingVector, RejectsWhenFull)
+{
+    vector::SpscRingVector<int> ring(2);
+
+    EXPECT_TRUE(ring.try_push(1));
+    EXPECT_TRUE(ring.try_push(2));
+    EXPECT_FALSE(ring.try_push(3));
+    EXPECT_EQ(ring.try_pop(), 1);
+    EXPECT_TRUE(ring.try_push(3));
+    EXPECT_EQ(ring.try_pop(), 2);
+    EXPECT_EQ(ring.try_pop(), 3);
+    EXPECT_EQ(ring.try_pop(), std::nullopt);
+}
+
+TEST(SpscRingVector, BulkTransfer)
+{
+    vector::SpscRingVector<std::string> ring(4);
+    const std::vector<std::string> values{"val1", "val2", "val3", "val4", "val5"};
+
+    EXPECT_EQ(ring.push_bulk(values), 4);
+
+    std::vector<std::string> out(3);
+    EXPECT_EQ(ring.pop_bulk(out), 3);
+    EXPECT_EQ(out, (std::vector<std::string>{"val1", "val2", "val3"}));
+    EXPECT_EQ(ring.size_approx(), 1);
+}
+
+TEST(SpscRingVector, FailedBulkPushDestroysPlacedValues)
+{
+    {
+        const std::vector<Counted> values{Counted(1), Counted(2), Counted(3)};
+        vector::SpscRingVector<Counted> ring(4);
+
+        Counted::copies_left = 2;
+        EXPECT_THROW(ring.push_bulk(values), std::runtime_error);
+        Counted::copies_left = -1;
+        EXPECT_EQ(Counted::alive, 3);
+        EXPECT_EQ(ring.size_approx(), 0);
+
+        EXPECT_EQ(ring.push_bulk(values), 3);
+        EXPECT_EQ(ring.try_pop()->value, 1);
+    }
+    EXPECT_EQ(Counted::alive, 0);
+}
+
+TEST(SpscRingVector, ProducerConsumerThreads)
+{
+    constexpr int count = 100000;
+    vector::SpscRingVector<int> ring(64);
+
+    std::thread producer([&ring] {
+        for (int i = 0; i < count;)
+        {
+            if (ring.try_push(i))
+            {
+                i++;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    long long sum = 0;
+    int expected = 0;
+    bool ordered = true;
+
+    while (expected < count)
+    {
+        if (const auto value = ring.try_pop())
+        {
+            ordered = ordered && (*value == expected);
+            sum += *value;
+            expected++;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(sum, static_cast<long long>(count) * (count - 1) / 2);
+}
@@ -0,0 +1,207 @@
+#include <vector/sort.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename T>
+vector::Vector<T> random_keys(std::size_t count, std::uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    vector::Vector<T> vec(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            vec.push_back(static_cast<T>(std::uniform_real_distribution<double>(-1e6, 1e6)(rng)));
+        }
+        else
+        {
+            vec.push_back(static_cast<T>(rng()));
+        }
+    }
+    return vec;
+}
+
+template <typename T>
+std::vector<T> to_std(const vector::Vector<T>& vec)
+{
+    return std::vector<T>(vec.data(), vec.data() + vec.size());
+}
+
+template <typename T>
+void expect_sorts_like_std(const vector::Vector<T>& input)
+{
+    std::vector<T> expected = to_std(input);
+    std::sort(expected.begin(), expected.end());
+
+    vector::Vector<T> vec = input;
+    vector::sort(vec);
+
+    EXPECT_EQ(to_std(vec), expected);
+}
+
+}  // namespace
+
+template <typename T>
+class RadixSort : public testing::Test
+{
+};
+
+using RadixTypes = testing::
+    Types<std::uint8_t, std::int16_t, std::uint32_t, std::int32_t, std::uint64_t, std::int64_t, float, double>;
+TYPED_TEST_SUITE(RadixSort, RadixTypes);
+
+TYPED_TEST(RadixSort, MatchesStdSort)
+{
+    for (const std::size_t count : {0, 1, 2, 15, 16, 17, 63, 64, 65, 1000, 100'000})
+    {
+        expect_sorts_like_std(random_keys<TypeParam>(count, count));
+    }
+}
+
+TYPED_TEST(RadixSort, ExtremesAndDuplicates)
+{
+    using limits = std::numeric_limits<TypeParam>;
+    vector::Vector<TypeParam> vec;
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        vec.push_back(static_cast<TypeParam>(i % 7));
+        vec.push_back(limits::max());
+        vec.push_back(limits::lowest());
+    }
+
+    expect_sorts_like_std(vec);
+}
+
+TEST(Sort, FloatSpecialValues)
+{
+    vector::Vector<float> vec;
+    vec.append({1.0F, -0.0F, 0.0F, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+                -1.5F, std::numeric_limits<float>::denorm_min()});
+
+    vector::sort(vec);
+
+    EXPECT_EQ(vec[0], -std::numeric_limits<float>::infinity());
+    EXPECT_EQ(vec[1], -1.5F);
+    EXPECT_TRUE(std::signbit(vec[2]));
+    EXPECT_FALSE(std::signbit(vec[3]));
+    EXPECT_EQ(vec[4], std::numeric_limits<float>::denorm_min());
+    EXPECT_EQ(vec[6], std::numeric_limits<float>::infinity());
+}
+
+TEST(Sort, SortByKeyIsStable)
+{
+    auto keys = random_keys<std::uint32_t>(50'000, 7);
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        keys[i] %= 1000;
+    }
+    vector::Vector<std::uint32_t> values(keys.size());
+    for (std::uint32_t i = 0; i < keys.size(); i++)
+    {
+        values.push_back(i);
+    }
+
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> expected;
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        expected.emplace_back(std::as_const(keys)[i], std::as_const(values)[i]);
+    }
+    std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    vector::sort_by_key(keys, values);
+
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        ASSERT_EQ(std::as_const(keys)[i], expected[i].first);
+        ASSERT_EQ(std::as_const(values)[i], expected[i].second);
+    }
+}
+
+TEST(Sort, SortByKeyPermutesNonTrivialValues)
+{
+    vector::Vector<double> keys;
+    keys.append({3.0, -1.0, 2.0, -1.0});
+    vector::Vector<std::string> values;
+    values.append({"three", "minus one", "two", "minus one again"});
+
+    vector::sort_by_key(keys, values);
+
+    EXPECT_EQ(to_std(keys), (std::vector<double>{-1.0, -1.0, 2.0, 3.0}));
+    EXPECT_EQ(to_std(values), (std::vector<std::string>{"minus one", "minus one again", "two", "three"}));
+
+    values.pop_back();
+    EXPECT_THROW(vector::sort_by_key(keys, values), std::invalid_argument);
+}
+
+TEST(Sort, ParallelMsdKeepsPairs)
+{
+    // Calls the MSD pass directly so that it runs with several threads on any machine.
+    const auto input = random_keys<std::uint64_t>(300'000, 3);
+    vector::Vector<std::uint64_t> keys = input;
+    vector::Vector<std::uint32_t> values(keys.size());
+    for (std::uint32_t i = 0; i < keys.size(); i++)
+    {
+        values.push_back(i);
+    }
+    std::vector<std::uint64_t> key_buffer(keys.size());
+    std::vector<std::uint32_t> value_buffer(keys.size());
+
+    vector::detail::msd_radix_sort(keys.data(), key_buffer.data(), values.data(), value_buffer.data(), keys.size(), 4);
+
+    std::vector<std::uint64_t> expected = to_std(input);
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(to_std(keys), expected);
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        ASSERT_EQ(std::as_const(input)[std::as_const(values)[i]], std::as_const(keys)[i]);
+    }
+}
+
+TEST(Sort, ComparatorAndNonRadixTypes)
+{
+    auto vec = random_keys<std::int32_t>(1000, 5);
+    vector::sort(vec, std::greater<>());
+    EXPECT_TRUE(std::is_sorted(vec.data(), vec.data() + vec.size(), std::greater<>()));
+
+    vector::Vector<std::string> words;
+    words.append({"pear", "apple", "fig"});
+    vector::sort(words);
+    EXPECT_EQ(to_std(words), (std::vector<std::string>{"apple", "fig", "pear"}));
+}
+
+TEST(Sort, SortingSharedVectorLeavesCopyIntact)
+{
+    const auto input = random_keys<std::uint32_t>(1000, 9);
+    vector::Vector<std::uint32_t> vec = input;
+
+    vector::sort(vec);
+
+    EXPECT_TRUE(std::is_sorted(vec.data(), vec.data() + vec.size()));
+    EXPECT_FALSE(std::is_sorted(input.data(), input.data() + input.size()));
+}
+
+TEST(Sort, ScratchIsReused)
+{
+    vector::SortScratch scratch;
+    auto vec = random_keys<std::uint64_t>(10'000, 11);
+
+    vector::sort(vec, scratch);
+    const std::size_t capacity = scratch.capacity();
+    EXPECT_GE(capacity, 10'000 * sizeof(std::uint64_t));
+
+    auto smaller = random_keys<std::uint64_t>(5'000, 12);
+    vector::sort(smaller, scratch);
+    EXPECT_EQ(scratch.capacity(), capacity);
+
+    scratch.release();
+    EXPECT_EQ(scratch.capacity(), 0);
+}
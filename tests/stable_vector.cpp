@@ -0,0 +1,165 @@
+#include <vector/stable_vector.hpp>
+#include <vector/arena.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+static_assert(std::random_access_iterator<vector::StableVector<int>::iterator>);
+static_assert(std::random_access_iterator<vector::StableVector<int>::const_iterator>);
+
+TEST(StableVector, IndexesAcrossSegments)
+{
+    vector::StableVector<std::size_t> vec;
+
+    for (std::size_t i = 0; i < 10'000; i++)
+    {
+        vec.push_back(i);
+    }
+
+    EXPECT_EQ(vec.size(), 10'000);
+    for (std::size_t i = 0; i < vec.size(); i++)
+    {
+        ASSERT_EQ(vec[i], i);
+    }
+    EXPECT_EQ(vec.front(), 0);
+    EXPECT_EQ(vec.back(), 9'999);
+}
+
+TEST(StableVector, CapacityGrowsBySegments)
+{
+    vector::StableVector<int> vec;
+    EXPECT_EQ(vec.capacity(), 0);
+
+    vec.push_back(1);
+    EXPECT_EQ(vec.capacity(), 16);
+
+    vec.reserve(17);
+    EXPECT_EQ(vec.capacity(), 48);
+    EXPECT_EQ(vec.segment_count(), 2);
+}
+
+TEST(StableVector, ReferencesSurviveGrowth)
+{
+    vector::StableVector<std::string> vec;
+    std::vector<const std::string*> addresses;
+
+    for (int i = 0; i < 100; i++)
+    {
+        addresses.push_back(&vec.emplace_back(std::to_string(i)));
+    }
+    for (int i = 100; i < 50'000; i++)
+    {
+        vec.emplace_back(std::to_string(i));
+    }
+
+    for (std::size_t i = 0; i < addresses.size(); i++)
+    {
+        EXPECT_EQ(&vec[i], addresses[i]);
+        EXPECT_EQ(*addresses[i], std::to_string(i));
+    }
+}
+
+TEST(StableVector, AtOutOfBounds)
+{
+    vector::StableVector<int> vec;
+    vec.push_back(1);
+
+    EXPECT_EQ(vec.at(0), 1);
+    EXPECT_THROW(vec.at(1), std::out_of_range);
+}
+
+TEST(StableVector, PopClearAndShrink)
+{
+    vector::StableVector<std::string> vec;
+    for (int i = 0; i < 60; i++)
+    {
+        vec.push_back(std::to_string(i));
+    }
+
+    for (int i = 0; i < 50; i++)
+    {
+        vec.pop_back();
+    }
+    EXPECT_EQ(vec.size(), 10);
+    EXPECT_EQ(vec.back(), "9");
+    EXPECT_EQ(vec.capacity(), 112);
+
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.capacity(), 16);
+
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.capacity(), 16);
+
+    vec.push_back("again");
+    EXPECT_EQ(vec[0], "again");
+}
+
+TEST(StableVector, CopyIsDeepAndMoveTransfers)
+{
+    vector::StableVector<std::string> vec;
+    for (int i = 0; i < 100; i++)
+    {
+        vec.push_back(std::to_string(i));
+    }
+
+    vector::StableVector<std::string> copy = vec;
+    copy[0] = "changed";
+    EXPECT_EQ(vec[0], "0");
+    EXPECT_EQ(copy.size(), 100);
+    EXPECT_EQ(copy[99], "99");
+
+    const std::string* first = &vec[0];
+    vector::StableVector<std::string> moved = std::move(vec);
+    EXPECT_EQ(&moved[0], first);
+    EXPECT_EQ(moved.size(), 100);
+
+    // NOLINTNEXTLINE(bugprone-use-after-move)
+    vec.push_back("reused");
+    EXPECT_EQ(vec.size(), 1);
+
+    vec = copy;
+    EXPECT_EQ(vec[0], "changed");
+}
+
+TEST(StableVector, IteratorsAndSegments)
+{
+    vector::StableVector<int> vec;
+    for (int i = 0; i < 1000; i++)
+    {
+        vec.push_back(999 - i);
+    }
+
+    std::sort(vec.begin(), vec.end());
+    EXPECT_TRUE(std::is_sorted(vec.cbegin(), vec.cend()));
+    EXPECT_EQ(std::accumulate(vec.begin(), vec.end(), 0), 999 * 1000 / 2);
+
+    std::size_t visited = 0;
+    for (std::size_t segment = 0; segment < vec.segment_count(); segment++)
+    {
+        for (const int value : std::as_const(vec).segment(segment))
+        {
+            EXPECT_EQ(value, static_cast<int>(visited));
+            ++visited;
+        }
+    }
+    EXPECT_EQ(visited, vec.size());
+}
+
+TEST(StableVector, SegmentsComeFromArena)
+{
+    vector::Arena arena;
+    vector::StableVector<int> vec(arena);
+    const std::size_t before = arena.bytes_used();
+
+    for (int i = 0; i < 1000; i++)
+    {
+        vec.push_back(i);
+    }
+
+    EXPECT_GE(arena.bytes_used() - before, 1000 * sizeof(int));
+    EXPECT_EQ(vec[999], 999);
+}
@@ -0,0 +1,120 @@
+#include <vector/vector.hpp>
+#include <vector/storage_pool.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+namespace {
+
+class StoragePoolTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        vector::StoragePool::enable(true);
+        vector::StoragePool::trim();
+        vector::StoragePool::reset_thread_stats();
+    }
+
+    void TearDown() override
+    {
+        vector::StoragePool::enable(false);
+        vector::StoragePool::set_thread_budget(vector::StoragePool::default_thread_budget);
+        vector::StoragePool::trim();
+    }
+};
+
+}  // namespace
+
+TEST_F(StoragePoolTest, ReusesFreedBuffer)
+{
+    constexpr std::size_t capacity = 100;
+
+    {
+        vector::Vector<int> vec(capacity);
+    }
+    {
+        vector::Vector<int> vec(capacity);
+    }
+
+    const auto stats = vector::StoragePool::thread_stats();
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_DOUBLE_EQ(stats.hit_rate(), 0.5);
+}
+
+TEST_F(StoragePoolTest, SizeClassIsPowerOfTwo)
+{
+    {
+        vector::Vector<char> vec(100);
+    }
+    {
+        vector::Vector<char> vec(128);
+    }
+    {
+        vector::Vector<char> vec(129);
+    }
+
+    const auto stats = vector::StoragePool::thread_stats();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 2);
+}
+
+TEST_F(StoragePoolTest, ReserveRecyclesOldBuffer)
+{
+    vector::Vector<std::string> vec;
+
+    for (int i = 0; i < 64; i++)
+    {
+        vec.push_back(std::to_string(i));
+    }
+
+    EXPECT_GT(vector::StoragePool::thread_stats().releases, 0);
+    EXPECT_GT(vector::StoragePool::thread_cached_bytes(), 0);
+
+    for (int i = 0; i < 64; i++)
+    {
+        EXPECT_EQ(vec[i], std::to_string(i));
+    }
+}
+
+TEST_F(StoragePoolTest, BudgetSpillsToDepot)
+{
+    constexpr std::size_t capacity = 1000;
+    vector::StoragePool::set_thread_budget(0);
+
+    std::thread producer([] {
+        vector::Vector<int> vec(capacity);
+        vec.push_back(1);
+    });
+    producer.join();
+
+    {
+        vector::Vector<int> vec(capacity);
+    }
+
+    EXPECT_EQ(vector::StoragePool::thread_stats().depot_hits, 1);
+    EXPECT_EQ(vector::StoragePool::thread_cached_bytes(), 0);
+}
+
+TEST_F(StoragePoolTest, DisabledPoolIsBypassed)
+{
+    vector::StoragePool::enable(false);
+
+    {
+        vector::Vector<int> vec(10);
+    }
+
+    const auto stats = vector::StoragePool::thread_stats();
+    EXPECT_EQ(stats.hits + stats.misses + stats.releases, 0);
+}
+
+TEST_F(StoragePoolTest, BufferFromDisabledPoolIsNotCached)
+{
+    vector::StoragePool::enable(false);
+    auto* vec = new vector::Vector<int>(10);
+    vector::StoragePool::enable(true);
+    delete vec;
+
+    EXPECT_EQ(vector::StoragePool::thread_stats().releases, 0);
+}
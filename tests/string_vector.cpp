@@ -0,0 +1,146 @@
+#include <vector/string_vector.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static_assert(std::random_access_iterator<vector::StringVector::iterator>);
+
+namespace {
+
+std::vector<std::string> contents(const vector::StringVector& vec)
+{
+    return {vec.begin(), vec.end()};
+}
+
+}  // namespace
+
+TEST(StringVector, PushAndRead)
+{
+    vector::StringVector vec;
+    vec.push_back("alpha");
+    vec.push_back("");
+    vec.push_back(std::string(100, 'x'));
+
+    EXPECT_EQ(vec.size(), 3);
+    EXPECT_EQ(vec[0], "alpha");
+    EXPECT_EQ(vec[1], "");
+    EXPECT_EQ(vec.back(), std::string(100, 'x'));
+    EXPECT_EQ(vec.char_count(), 105);
+    EXPECT_EQ(vec.at(0), "alpha");
+    EXPECT_THROW(vec.at(3), std::out_of_range);
+}
+
+TEST(StringVector, PushOwnElement)
+{
+    vector::StringVector vec(1, 4);
+    vec.push_back("self");
+    for (int i = 0; i < 6; i++)
+    {
+        vec.push_back(vec[0]);
+    }
+
+    EXPECT_EQ(vec.size(), 7);
+    EXPECT_TRUE(std::all_of(vec.begin(), vec.end(), [](std::string_view value) { return value == "self"; }));
+}
+
+TEST(StringVector, CopiesShareUntilWritten)
+{
+    vector::StringVector vec{"one", "two", "three"};
+    const vector::StringVector copy = vec;
+    EXPECT_EQ(copy[1].data(), vec[1].data());
+
+    vec.assign(1, "TWO");
+    EXPECT_EQ(vec[1], "TWO");
+    EXPECT_EQ(copy[1], "two");
+    EXPECT_EQ(copy, (vector::StringVector{"one", "two", "three"}));
+}
+
+TEST(StringVector, AssignInPlaceOrAppended)
+{
+    vector::StringVector vec{"short", "middle"};
+    const std::size_t chars = vec.char_count();
+
+    vec.assign(0, "tiny");
+    EXPECT_EQ(vec[0], "tiny");
+    EXPECT_EQ(vec.garbage_count(), 1);
+
+    vec.assign(1, vec[0]);
+    EXPECT_EQ(vec[1], "tiny");
+    EXPECT_EQ(vec.char_count(), chars - 3);
+
+    vec.assign(0, "a much longer replacement");
+    EXPECT_EQ(vec[0], "a much longer replacement");
+    EXPECT_EQ(vec[1], "tiny");
+}
+
+TEST(StringVector, EraseCompactsOnceGarbageDominates)
+{
+    vector::StringVector vec;
+    for (int i = 0; i < 100; i++)
+    {
+        vec.push_back(std::to_string(i * 1000));
+    }
+
+    vec.erase(vec.begin() + 10, vec.begin() + 20);
+    EXPECT_EQ(vec.size(), 90);
+    EXPECT_EQ(vec[10], "20000");
+    EXPECT_GT(vec.garbage_count(), 0);
+
+    const auto it = vec.erase(vec.begin());
+    EXPECT_EQ(*it, "1000");
+
+    while (vec.size() > 10)
+    {
+        vec.erase(vec.begin() + 5);
+        ASSERT_LE(vec.garbage_count(), vec.char_count());
+    }
+    const std::vector<std::string> expected{
+        "1000", "2000", "3000", "4000", "5000", "95000", "96000", "97000", "98000", "99000"};
+    EXPECT_EQ(contents(vec), expected);
+
+    vec.compact();
+    EXPECT_EQ(vec.garbage_count(), 0);
+    EXPECT_EQ(vec[4], "5000");
+}
+
+TEST(StringVector, EraseIfAndPopBack)
+{
+    vector::StringVector vec{"keep", "drop", "keep too", "drop", "last"};
+
+    EXPECT_EQ(vec.erase_if([](std::string_view value) { return value == "drop"; }), 2);
+    EXPECT_EQ(contents(vec), (std::vector<std::string>{"keep", "keep too", "last"}));
+
+    vec.pop_back();
+    EXPECT_EQ(vec.garbage_count(), 8);
+    vec.assign(0, "a longer first value");
+    vec.pop_back();
+    EXPECT_EQ(contents(vec), (std::vector<std::string>{"a longer first value"}));
+
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.garbage_count(), 0);
+}
+
+TEST(StringVector, ConvertsAndAppendsInBulk)
+{
+    vector::Vector<std::string> strings;
+    strings.append({"red", "green", "blue"});
+
+    vector::StringVector vec(strings);
+    vec.append(vec);
+    vector::StringVector other{"x", "yy", "zzz"};
+    other.assign(0, "replaced");
+    vec.append(other);
+
+    const vector::Vector<std::string> back = vec.to_vector();
+    EXPECT_EQ(std::vector<std::string>(back.begin(), back.end()),
+              (std::vector<std::string>{"red", "green", "blue", "red", "green", "blue", "replaced", "yy", "zzz"}));
+
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.garbage_count(), 0);
+    EXPECT_EQ(vec[6], "replaced");
+}
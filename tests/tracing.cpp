@@ -0,0 +1,227 @@
+#include <vector/tracing.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Hooks are selected per element type, so these specializations trace only the types below and leave every other
+// Vector in the test binary untouched.
+
+namespace {
+
+struct Recorded
+{
+    int value;
+};
+
+struct Sampled
+{
+    int value;
+};
+
+struct Recorder
+{
+    static std::vector<vector::trace::Record>& records()
+    {
+        static std::vector<vector::trace::Record> all;
+        return all;
+    }
+
+    static void record(const vector::trace::Record& record) noexcept
+    {
+        records().push_back(record);
+    }
+};
+
+}  // namespace
+
+template <>
+struct vector::trace::Hook<Recorded>
+{
+    using type = Recorder;
+};
+
+template <>
+struct vector::trace::Hook<Sampled>
+{
+    using type = vector::trace::HistogramSink;
+};
+
+#include <vector/vector.hpp>
+
+static_assert(vector::trace::enabled<Recorded>);
+static_assert(!vector::trace::enabled<int>);
+
+namespace {
+
+std::vector<vector::trace::Event> events()
+{
+    std::vector<vector::trace::Event> result;
+    for (const vector::trace::Record& record : Recorder::records())
+    {
+        result.push_back(record.event);
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(Tracing, ReportsEachEvent)
+{
+    using vector::trace::Event;
+    Recorder::records().clear();
+    {
+        vector::Vector<Recorded> vec;
+        vec.push_back({1});
+        vec.push_back({2});
+        // The old buffer is released inside the reallocation, so its destroy is reported first.
+        ASSERT_EQ(events(), (std::vector<Event>{Event::destroy, Event::reallocate}));
+
+        const vector::trace::Record& grow = Recorder::records()[1];
+        EXPECT_EQ(grow.owner, &vec);
+        EXPECT_EQ(grow.element_size, sizeof(Recorded));
+        EXPECT_EQ(grow.size, 2);
+        EXPECT_EQ(grow.old_capacity, 1);
+        EXPECT_EQ(grow.new_capacity, 2);
+        EXPECT_EQ(grow.bytes_moved, sizeof(Recorded));
+        EXPECT_EQ(Recorder::records()[0].owner, nullptr);
+        EXPECT_EQ(Recorder::records()[0].buffer, grow.buffer);
+
+        Recorder::records().clear();
+        vec.reserve(10);
+        vec.shrink_to_fit();
+        const vector::Vector<Recorded> copy = vec;
+        vec.data()[0].value = 3;
+        EXPECT_EQ(events(), (std::vector<Event>{Event::destroy, Event::reserve, Event::destroy, Event::shrink_to_fit,
+                                                Event::detach}));
+        EXPECT_EQ(Recorder::records()[1].new_capacity, 10);
+        EXPECT_EQ(Recorder::records()[3].new_capacity, 2);
+        EXPECT_EQ(Recorder::records()[4].bytes_moved, 2 * sizeof(Recorded));
+        EXPECT_EQ(copy[0].value, 1);
+
+        Recorder::records().clear();
+    }
+    EXPECT_EQ(events(), (std::vector<Event>{Event::destroy, Event::destroy}));
+    EXPECT_EQ(Recorder::records()[0].size, 2);
+}
+
+TEST(Tracing, ReserveInPlaceMovesNothing)
+{
+    Recorder::records().clear();
+    vector::Arena arena;
+    vector::Vector<Recorded> vec(arena);
+    vec.push_back({1});
+    vec.reserve(64);
+
+    ASSERT_EQ(events(), (std::vector<vector::trace::Event>{vector::trace::Event::reserve}));
+    EXPECT_EQ(Recorder::records()[0].bytes_moved, 0);
+    EXPECT_EQ(Recorder::records()[0].new_capacity, 64);
+}
+
+TEST(Tracing, SitesTagEvents)
+{
+    Recorder::records().clear();
+    vector::Vector<Recorded> vec;
+    vec.reserve(2);
+    EXPECT_EQ(Recorder::records()[1].location.line(), 0);
+
+    const vector::trace::Site outer;
+    vec.reserve(4);
+    {
+        const vector::trace::Site inner;
+        vec.reserve(8);
+    }
+    vec.reserve(16);
+
+    ASSERT_EQ(Recorder::records().size(), 8);
+    const std::uint_least32_t outer_line = Recorder::records()[3].location.line();
+    EXPECT_NE(outer_line, 0);
+    EXPECT_GT(Recorder::records()[5].location.line(), outer_line);
+    EXPECT_EQ(Recorder::records()[7].location.line(), outer_line);
+}
+
+TEST(Tracing, HistogramSinkAggregatesPerSite)
+{
+    using vector::trace::HistogramSink;
+    HistogramSink::reset();
+    {
+        const vector::trace::Site site;
+        for (int i = 0; i < 10; i++)
+        {
+            vector::Vector<Sampled> vec;
+            vec.reserve(100);
+        }
+    }
+
+    EXPECT_EQ(HistogramSink::histogram(vector::trace::Event::reserve).count(), 10);
+    EXPECT_EQ(HistogramSink::histogram(vector::trace::Event::destroy).count(), 20);
+
+    int sites = 0;
+    HistogramSink::for_each_site([&sites](const vector::trace::SiteStats& stats) {
+        sites++;
+        EXPECT_EQ(stats.count, stats.event == vector::trace::Event::reserve ? 10 : 20);
+        EXPECT_LE(stats.max_ns, stats.total_ns);
+        EXPECT_NE(stats.location.line(), 0);
+    });
+    EXPECT_EQ(sites, 2);
+    EXPECT_EQ(HistogramSink::dropped_sites(), 0);
+}
+
+TEST(Tracing, HistogramSinkRecordsFromManyThreads)
+{
+    using vector::trace::HistogramSink;
+    HistogramSink::reset();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([] {
+            const vector::trace::Site site;
+            vector::Vector<Sampled> vec;
+            for (int i = 0; i < 1000; i++)
+            {
+                vec.push_back({i});
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::uint64_t reallocations = 0;
+    HistogramSink::for_each_site([&reallocations](const vector::trace::SiteStats& stats) {
+        if (stats.event == vector::trace::Event::reallocate)
+        {
+            reallocations += stats.count;
+            EXPECT_GT(stats.bytes_moved, 0);
+        }
+    });
+    EXPECT_EQ(reallocations, 4 * 10);
+    EXPECT_EQ(HistogramSink::histogram(vector::trace::Event::reallocate).count(), reallocations);
+}
+
+TEST(Tracing, HistogramQuantiles)
+{
+    vector::trace::Histogram histogram;
+    for (std::uint64_t ns = 1; ns <= 100; ns++)
+    {
+        histogram.add(ns);
+    }
+    histogram.add(5000);
+
+    EXPECT_EQ(histogram.count(), 101);
+    EXPECT_EQ(histogram.sum(), 5050 + 5000);
+    EXPECT_EQ(histogram.max(), 5000);
+    EXPECT_EQ(histogram.quantile(0.5), 63);
+    EXPECT_EQ(histogram.quantile(0.99), 127);
+    EXPECT_EQ(histogram.quantile(1.0), 5000);
+
+    histogram.add(UINT64_MAX);
+    EXPECT_EQ(histogram.quantile(1.0), UINT64_MAX);
+    EXPECT_EQ(histogram.quantile(0.5), 63);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.count(), 0);
+    EXPECT_EQ(histogram.quantile(0.5), 0);
+}
@@ -4,6 +4,37 @@
 #include <memory>
 #include <vector>
 #include <stdexcept>
+#include <sstream>
+#include <iterator>
+
+namespace {
+
+struct Tracked
+{
+    static inline int alive = 0;
+    int value;
+
+    explicit Tracked(int value) : value(value)
+    {
+        ++alive;
+    }
+    Tracked(const Tracked& other) : value(other.value)
+    {
+        ++alive;
+    }
+    Tracked(Tracked&& other) noexcept : value(other.value)
+    {
+        ++alive;
+    }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) noexcept = default;
+    ~Tracked()
+    {
+        --alive;
+    }
+};
+
+}  // namespace
 
 TEST(VecStorage, DefaultConstructor)
 {
@@ -655,3 +686,260 @@ TEST(Vector, InsertRangeElementsToEnd)
         EXPECT_EQ(vec.at(i), exp_values.at(i));
     }
 }
+
+TEST(Vector, AppendRangeReservesOnce)
+{
+    constexpr std::size_t count = 100;
+    vector::Vector<std::string> vec;
+
+    std::vector<std::string> values;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        values.push_back(std::to_string(i));
+    }
+
+    vec.append(values.begin(), values.end());
+
+    EXPECT_EQ(vec.size(), count);
+    EXPECT_EQ(vec.capacity(), count);
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        EXPECT_EQ(vec.at(i), values.at(i));
+    }
+}
+
+TEST(Vector, AppendInitializerList)
+{
+    vector::Vector<std::string> vec;
+    vec.push_back("val1");
+
+    vec.append({"val2", "val3"});
+
+    std::vector<std::string> exp_values{"val1", "val2", "val3"};
+
+    EXPECT_EQ(vec.size(), exp_values.size());
+    for (std::size_t i = 0; i < vec.size(); i++)
+    {
+        EXPECT_EQ(vec.at(i), exp_values.at(i));
+    }
+}
+
+TEST(Vector, AppendInputIterators)
+{
+    std::istringstream stream("1 2 3 4 5 6 7 8 9 10");
+    vector::Vector<int> vec;
+
+    vec.append(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+
+    EXPECT_EQ(vec.size(), 10);
+    for (std::size_t i = 0; i < vec.size(); i++)
+    {
+        EXPECT_EQ(vec.at(i), static_cast<int>(i) + 1);
+    }
+}
+
+TEST(Vector, InsertInputIterators)
+{
+    std::istringstream stream("7 8 9");
+    vector::Vector<int> vec;
+    vec.append({1, 2, 3});
+
+    auto iter = vec.insert(vec.begin() + 1, std::istream_iterator<int>(stream), std::istream_iterator<int>());
+
+    std::vector<int> exp_values{1, 7, 8, 9, 2, 3};
+
+    EXPECT_EQ(*iter, 7);
+    EXPECT_EQ(vec.size(), exp_values.size());
+    for (std::size_t i = 0; i < vec.size(); i++)
+    {
+        EXPECT_EQ(vec.at(i), exp_values.at(i));
+    }
+}
+
+TEST(Vector, InsertRangeLongerThanTail)
+{
+    vector::Vector<std::string> vec;
+    vec.append({"val1", "val2", "val3"});
+
+    std::vector<std::string> values{"new1", "new2", "new3", "new4"};
+    vec.insert(vec.begin() + 2, values.begin(), values.end());
+
+    std::vector<std::string> exp_values{"val1", "val2", "new1", "new2", "new3", "new4", "val3"};
+
+    EXPECT_EQ(vec.size(), exp_values.size());
+    for (std::size_t i = 0; i < vec.size(); i++)
+    {
+        EXPECT_EQ(vec.at(i), exp_values.at(i));
+    }
+}
+
+TEST(Vector, InsertRangeFromSelf)
+{
+    vector::Vector<std::string> vec;
+    vec.append({"val1", "val2", "val3", "val4"});
+
+    vec.insert(vec.begin() + 1, vec.cbegin() + 2, vec.cend());
+
+    std::vector<std::string> exp_values{"val1", "val3", "val4", "val2", "val3", "val4"};
+
+    EXPECT_EQ(vec.size(), exp_values.size());
+    for (std::size_t i = 0; i < vec.size(); i++)
+    {
+        EXPECT_EQ(vec.at(i), exp_values.at(i));
+    }
+}
+
+TEST(Vector, InsertRangeWithoutDefaultConstructor)
+{
+    struct NoDefault
+    {
+        explicit NoDefault(int value) : value(value)
+        {
+        }
+        int value;
+    };
+
+    vector::Vector<NoDefault> vec;
+    vec.push_back(NoDefault{1});
+    vec.push_back(NoDefault{4});
+
+    std::vector<NoDefault> values{NoDefault{2}, NoDefault{3}};
+    vec.insert(vec.begin() + 1, values.begin(), values.end());
+
+    EXPECT_EQ(vec.size(), 4);
+    for (std::size_t i = 0; i < vec.size(); i++)
+    {
+        EXPECT_EQ(vec.at(i).value, static_cast<int>(i) + 1);
+    }
+}
+
+TEST(Vector, EraseDestroysVacatedElements)
+{
+    {
+        vector::Vector<Tracked> vec;
+        for (int i = 0; i < 6; i++)
+        {
+            vec.push_back(Tracked{i});
+        }
+
+        vec.erase(vec.begin() + 1);
+        EXPECT_EQ(Tracked::alive, 5);
+
+        vec.erase(vec.begin(), vec.begin() + 2);
+        EXPECT_EQ(Tracked::alive, 3);
+        EXPECT_EQ(vec.at(0).value, 3);
+    }
+
+    EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(Vector, EraseIf)
+{
+    vector::Vector<Tracked> vec;
+    for (int i = 0; i < 10; i++)
+    {
+        vec.push_back(Tracked{i});
+    }
+
+    const std::size_t removed = vec.erase_if([](const Tracked& elem) { return elem.value % 3 == 0; });
+
+    std::vector<int> exp_values{1, 2, 4, 5, 7, 8};
+
+    EXPECT_EQ(removed, 4);
+    EXPECT_EQ(Tracked::alive, exp_values.size());
+    EXPECT_EQ(vec.size(), exp_values.size());
+    for (std::size_t i = 0; i < vec.size(); i++)
+    {
+        EXPECT_EQ(vec.at(i).value, exp_values.at(i));
+    }
+}
+
+TEST(Vector, EraseIfWithoutMatchKeepsStorageShared)
+{
+    vector::Vector<int> vec;
+    vec.append({1, 2, 3});
+    const vector::Vector<int> copy = vec;
+
+    EXPECT_EQ(vector::erase_if(vec, [](int elem) { return elem > 10; }), 0);
+    EXPECT_EQ(std::as_const(vec).data(), copy.data());
+}
+
+TEST(Vector, EraseValue)
+{
+    vector::Vector<std::string> vec;
+    vec.append({"val1", "val2", "val1", "val3"});
+    const vector::Vector<std::string> copy = vec;
+
+    EXPECT_EQ(vector::erase(vec, "val1"), 2);
+    EXPECT_EQ(vec.size(), 2);
+    EXPECT_EQ(vec.at(0), "val2");
+    EXPECT_EQ(vec.at(1), "val3");
+    EXPECT_EQ(copy.size(), 4);
+}
+
+TEST(Vector, SwapRemove)
+{
+    vector::Vector<std::string> vec;
+    vec.append({"val1", "val2", "val3", "val4"});
+
+    auto iter = vec.swap_remove(vec.begin() + 1);
+
+    EXPECT_EQ(*iter, "val4");
+    EXPECT_EQ(vec.size(), 3);
+    EXPECT_EQ(vec.at(2), "val3");
+
+    vec.swap_remove(vec.end() - 1);
+
+    EXPECT_EQ(vec.size(), 2);
+    EXPECT_EQ(vec.at(1), "val4");
+}
+
+TEST(Vector, EraseIndices)
+{
+    vector::Vector<Tracked> vec;
+    for (int i = 0; i < 10; i++)
+    {
+        vec.push_back(Tracked{i});
+    }
+
+    const std::vector<std::size_t> indices{0, 3, 4, 9};
+    EXPECT_EQ(vec.erase_indices(indices), indices.size());
+
+    std::vector<int> exp_values{1, 2, 5, 6, 7, 8};
+
+    EXPECT_EQ(Tracked::alive, exp_values.size());
+    EXPECT_EQ(vec.size(), exp_values.size());
+    for (std::size_t i = 0; i < vec.size(); i++)
+    {
+        EXPECT_EQ(vec.at(i).value, exp_values.at(i));
+    }
+}
+
+TEST(Vector, EraseIndicesOutOfRange)
+{
+    vector::Vector<int> vec;
+    vec.append({1, 2, 3});
+
+    const std::vector<std::size_t> indices{1, 3};
+
+    EXPECT_THROW(vec.erase_indices(indices), std::out_of_range);
+    EXPECT_EQ(vec.size(), 3);
+
+    const std::vector<std::size_t> past_front{100, 100};
+    EXPECT_THROW(vec.erase_indices(past_front), std::out_of_range);
+    EXPECT_EQ(vec.size(), 3);
+}
+
+TEST(Vector, EraseIndicesWithDuplicates)
+{
+    vector::Vector<int> vec;
+    vec.append({0, 1, 2, 3, 4});
+
+    const std::vector<std::size_t> indices{1, 1, 3, 3, 3};
+    EXPECT_EQ(vec.erase_indices(indices), 2);
+    EXPECT_EQ(vec.size(), 3);
+    EXPECT_EQ(vec[0], 0);
+    EXPECT_EQ(vec[1], 2);
+    EXPECT_EQ(vec[2], 4);
+}
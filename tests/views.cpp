@@ -0,0 +1,235 @@
+#include <vector/views.hpp>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+vector::Vector<int> iota(int count)
+{
+    vector::Vector<int> vec;
+    for (int i = 0; i < count; i++)
+    {
+        vec.push_back(i);
+    }
+    return vec;
+}
+
+template <typename T>
+std::vector<T> to_std(const vector::Vector<T>& vec)
+{
+    return std::vector<T>(vec.data(), vec.data() + vec.size());
+}
+
+}  // namespace
+
+TEST(Views, TransformFilterCollect)
+{
+    const vector::Vector<int> vec = iota(10);
+
+    const auto result = vec | vector::views::filter([](int x) { return x % 2 == 0; })
+                        | vector::views::transform([](int x) { return x * x; }) | vector::collect();
+
+    EXPECT_EQ(to_std(result), (std::vector<int>{0, 4, 16, 36, 64}));
+}
+
+TEST(Views, FunctionsAndPipesAgree)
+{
+    const vector::Vector<int> vec = iota(7);
+    const auto twice = [](int x) { return 2 * x; };
+
+    EXPECT_EQ(
+        to_std(vector::collect(vector::views::transform(vec, twice))),
+        to_std(vec | vector::views::transform(twice) | vector::collect()));
+}
+
+TEST(Views, FusesIntoOnePass)
+{
+    const vector::Vector<int> vec = iota(100);
+    int calls = 0;
+
+    const auto result = vec | vector::views::transform([&calls](int x) {
+                            ++calls;
+                            return x + 1;
+                        })
+                        | vector::views::filter([](int x) { return x % 3 == 0; }) | vector::collect();
+
+    EXPECT_EQ(result.size(), 33);
+    // The filter dereferences each element once to test it and once more for the ones it keeps.
+    EXPECT_EQ(calls, 100 + 33);
+}
+
+TEST(Views, SizedCollectAllocatesExactly)
+{
+    const vector::Vector<int> vec = iota(1000);
+
+    const auto mapped = vec | vector::views::transform([](int x) { return x * 0.5; }) | vector::collect();
+    EXPECT_EQ(mapped.size(), 1000);
+    EXPECT_EQ(mapped.capacity(), 1000);
+
+    const auto strided = vector::collect(vector::views::stride(vec, 3));
+    EXPECT_EQ(strided.size(), 334);
+    EXPECT_EQ(strided.capacity(), 334);
+}
+
+TEST(Views, CollectConvertsElementType)
+{
+    const vector::Vector<int> vec = iota(3);
+
+    const auto strings
+        = vec | vector::views::transform([](int x) { return std::to_string(x); }) | vector::collect<std::string>();
+    const auto wide = vector::collect<long long>(vec);
+
+    EXPECT_EQ(to_std(strings), (std::vector<std::string>{"0", "1", "2"}));
+    EXPECT_EQ(to_std(wide), (std::vector<long long>{0, 1, 2}));
+}
+
+TEST(Views, ZipStopsAtShorter)
+{
+    const vector::Vector<int> keys = iota(5);
+    vector::Vector<std::string> names;
+    names.append({"a", "b", "c"});
+
+    const auto zipped = vector::views::zip(keys, names);
+    EXPECT_EQ(zipped.size(), 3);
+
+    std::vector<std::string> seen;
+    for (const auto& [key, name] : zipped)
+    {
+        seen.push_back(std::to_string(key) + name);
+    }
+    EXPECT_EQ(seen, (std::vector<std::string>{"0a", "1b", "2c"}));
+
+    const vector::Vector<std::pair<int, std::string>> pairs = vector::collect(zipped);
+    EXPECT_EQ(pairs[2], (std::pair<int, std::string>{2, "c"}));
+
+    const auto sums = vector::views::zip(keys, keys | vector::views::stride(2))
+                      | vector::views::transform([](const auto& pair) { return pair.first + pair.second; })
+                      | vector::collect();
+    EXPECT_EQ(to_std(sums), (std::vector<int>{0, 3, 6}));
+}
+
+TEST(Views, EnumerateOverFilter)
+{
+    const vector::Vector<int> vec = iota(10);
+
+    std::vector<std::pair<std::size_t, int>> seen;
+    const auto large = vec | vector::views::filter([](int x) { return x > 6; });
+    for (const auto& [index, value] : large | vector::views::enumerate())
+    {
+        seen.emplace_back(index, value);
+    }
+
+    EXPECT_EQ(seen, (std::vector<std::pair<std::size_t, int>>{{0, 7}, {1, 8}, {2, 9}}));
+}
+
+TEST(Views, Chunk)
+{
+    const vector::Vector<int> vec = iota(7);
+
+    const auto chunks = vec | vector::views::chunk(3);
+    EXPECT_EQ(chunks.size(), 3);
+
+    const auto sums = chunks | vector::views::transform([](const auto& chunk) {
+                          int sum = 0;
+                          for (const int x : chunk)
+                          {
+                              sum += x;
+                          }
+                          return sum;
+                      })
+                      | vector::collect();
+    EXPECT_EQ(to_std(sums), (std::vector<int>{3, 12, 6}));
+
+    const auto evens = vec | vector::views::filter([](int x) { return x % 2 == 0; }) | vector::views::chunk(3);
+    std::vector<std::size_t> sizes;
+    for (const auto& chunk : evens)
+    {
+        sizes.push_back(static_cast<std::size_t>(std::distance(chunk.begin(), chunk.end())));
+    }
+    EXPECT_EQ(sizes, (std::vector<std::size_t>{3, 1}));
+}
+
+TEST(Views, CollectedChunksOwnTheirValues)
+{
+    const vector::Vector<int> vec = iota(7);
+    const std::string key(40, 'k');
+
+    const auto chunks = vec | vector::views::transform([key](int x) { return x + static_cast<int>(key.size()); })
+                        | vector::views::chunk(2) | vector::collect();
+    ASSERT_EQ(chunks.size(), 4);
+    EXPECT_EQ(to_std(chunks[0]), (std::vector<int>{40, 41}));
+    EXPECT_EQ(to_std(chunks[3]), (std::vector<int>{46}));
+
+    int sum = 0;
+    for (const vector::Vector<int>& chunk : chunks)
+    {
+        for (const int x : chunk)
+        {
+            sum += x;
+        }
+    }
+    EXPECT_EQ(sum, 301);
+
+    const auto odd = vec | vector::views::filter([key](int x) { return x % 2 == 1; }) | vector::views::chunk(2)
+                     | vector::collect();
+    ASSERT_EQ(odd.size(), 2);
+    EXPECT_EQ(to_std(odd[1]), (std::vector<int>{5}));
+}
+
+TEST(Views, SliceClampsToRange)
+{
+    const vector::Vector<int> vec = iota(10);
+
+    EXPECT_EQ(to_std(vec | vector::views::slice(2, 5) | vector::collect()), (std::vector<int>{2, 3, 4}));
+    EXPECT_EQ((vec | vector::views::slice(8, 20)).size(), 2);
+    EXPECT_TRUE((vec | vector::views::slice(12, 20)).empty());
+    EXPECT_TRUE((vec | vector::views::slice(5, 3)).empty());
+
+    const auto odd = vec | vector::views::filter([](int x) { return x % 2 == 1; }) | vector::views::slice(1, 3);
+    EXPECT_EQ(to_std(vector::collect(odd)), (std::vector<int>{3, 5}));
+}
+
+TEST(Views, SliceOwnsCapturingViews)
+{
+    const vector::Vector<int> vec = iota(10);
+    const std::string suffix = "!";
+    const int limit = 4;
+
+    const auto shouted = vec | vector::views::transform([suffix](int x) { return std::to_string(x) + suffix; })
+                         | vector::views::slice(1, 3);
+    EXPECT_EQ(shouted.size(), 2);
+    EXPECT_EQ(to_std(vector::collect(shouted)), (std::vector<std::string>{"1!", "2!"}));
+
+    const auto small = vec | vector::views::filter([limit](int x) { return x < limit; }) | vector::views::slice(2, 9);
+    EXPECT_EQ(to_std(vector::collect(small)), (std::vector<int>{2, 3}));
+    EXPECT_EQ(to_std(vector::collect(vector::views::slice(small, 1, 2))), (std::vector<int>{3}));
+}
+
+TEST(Views, RandomAccessThroughTransform)
+{
+    const vector::Vector<int> vec = iota(10);
+    const auto view = vec | vector::views::transform([](int x) { return x * 10; });
+
+    static_assert(std::random_access_iterator<decltype(view.begin())>);
+    static_assert(std::random_access_iterator<decltype(vector::views::zip(vec, view).begin())>);
+    static_assert(std::random_access_iterator<decltype(vector::views::enumerate(view).begin())>);
+    EXPECT_EQ(view.begin()[4], 40);
+    EXPECT_EQ(view.end() - view.begin(), 10);
+
+    const auto strided = view | vector::views::stride(4) | vector::collect();
+    EXPECT_EQ(to_std(strided), (std::vector<int>{0, 40, 80}));
+}
+
+TEST(Views, ReadingDoesNotUnshare)
+{
+    const vector::Vector<int> vec = iota(4);
+    vector::Vector<int> copy = vec;
+
+    const auto total = vector::collect(copy | vector::views::transform([](int x) { return x + 1; }));
+
+    EXPECT_EQ(total.size(), 4);
+    EXPECT_EQ(std::as_const(copy).data(), vec.data());
+}